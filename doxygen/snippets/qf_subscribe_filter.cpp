@@ -0,0 +1,21 @@
+// the event carrying data of one of many channels
+struct DataEvt : public QP::QEvt {
+    std::uint8_t channel;
+    std::uint8_t data[16];
+};
+
+// accept only the DATA events of the channel handled by the AO 'me'
+static bool channelFilter(void const * const me, QP::QEvt const * const e) {
+    return (e->sig != DATA_SIG)
+           || (static_cast<DataEvt const *>(e)->channel
+               == static_cast<Channel const *>(me)->m_channel);
+}
+
+Q_STATE_DEF(Channel, initial) {
+
+    setPublishFilter(&channelFilter); // <--- filter of the published events
+    subscribe(DATA_SIG);              // <--- filtered by channelFilter()
+    subscribe(TERMINATE_SIG);         // <--- passes channelFilter()
+
+    return tran(&active);
+}
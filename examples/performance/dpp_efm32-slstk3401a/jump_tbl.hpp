@@ -0,0 +1,203 @@
+//============================================================================
+// Product: Signal-indexed jump tables for QHsm-style state handlers
+// Last updated for version 7.0.1
+// Last updated on  2022-05-20
+//
+//                    Q u a n t u m  L e a P s
+//                    ------------------------
+//                    Modern Embedded Software
+//
+// Copyright (C) 2005-2022 Quantum Leaps, LLC. All rights reserved.
+//
+// This program is open source software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Alternatively, this program may be distributed and modified under the
+// terms of Quantum Leaps commercial licenses, which expressly supersede
+// the GNU General Public License and are specifically designed for
+// licensees interested in retaining the proprietary status of their code.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <www.gnu.org/licenses/>.
+//
+// Contact information:
+// <www.state-machine.com/licensing>
+// <info@state-machine.com>
+//============================================================================
+#ifndef JUMP_TBL_HPP
+#define JUMP_TBL_HPP
+
+namespace DPP {
+
+//............................................................................
+//! Signal-indexed jump table of a single state (see NOTE1)
+//!
+//! @description
+//! Each state lists only the signals it handles in a sparse map of
+//! signal/action pairs. The constructor resolves the sparse map into a
+//! dense array indexed directly by the signal, so that a state handler
+//! becomes a single indexed call instead of a `switch` statement.
+//! The signals are bounded by @p MAX_SIG_, which must be above
+//! QP::Q_USER_SIG and above all signals used by the state machine
+//! (published, posted, and internal).
+//!
+//! @tparam MAX_SIG_ the last (exclusive) signal used by the state machine
+//!
+template<QP::QSignal MAX_SIG_>
+class QSigJumpTbl {
+public:
+    //! one signal/action pair of the sparse map
+    struct Entry {
+        QP::QSignal sig;           //!< signal handled by the state
+        QP::QStateHandler act;     //!< action for the signal
+    };
+
+    //! resolves the sparse map into the dense jump table
+    QSigJumpTbl(Entry const * const map, std::uint_fast8_t const n,
+                QP::QStateHandler const superstate) noexcept
+      : m_super(superstate)
+    {
+        static_assert(MAX_SIG_ > QP::Q_USER_SIG,
+                      "MAX_SIG_ must be above Q_USER_SIG");
+        for (QP::QSignal sig = 0U; sig < MAX_SIG_; ++sig) {
+            m_act[sig] = Q_STATE_CAST(0);
+        }
+        for (std::uint_fast8_t i = 0U; i < n; ++i) {
+#ifndef Q_NASSERT
+            // the empty signal is reserved for discovering the superstate
+            if ((map[i].sig == 0U) || (map[i].sig >= MAX_SIG_)) {
+                Q_onAssert("jump_tbl", static_cast<int_t>(__LINE__));
+            }
+#endif // Q_NASSERT
+            m_act[map[i].sig] = map[i].act;
+        }
+    }
+
+    //! action for the signal @p sig or NULL if the state does not handle it
+    QP::QStateHandler lookup(QP::QSignal const sig) const noexcept {
+        return (sig < MAX_SIG_) ? m_act[sig] : Q_STATE_CAST(0);
+    }
+
+    //! the superstate of this state
+    QP::QStateHandler superstate(void) const noexcept {
+        return m_super;
+    }
+
+private:
+    QP::QStateHandler m_act[MAX_SIG_]; //!< dense table indexed by signal
+    QP::QStateHandler const m_super;   //!< superstate of this state
+};
+
+//............................................................................
+//! Active object whose state handlers dispatch through QSigJumpTbl
+//!
+//! @description
+//! A state handler of this class consists of a single call:
+//! `return jump(myState_tbl, e);` The actions in the table are handlers
+//! with the QP::QStateHandler signature (declared with Q_STATE_DECL() and
+//! defined with Q_STATE_DEF()), so they return Q_HANDLED(), tran(), or
+//! Q_UNHANDLED() exactly as the code inside a `case` would.
+//!
+class QJumpActive : public QP::QActive {
+protected:
+    //! protected constructor (abstract class)
+    explicit QJumpActive(QP::QStateHandler const initial) noexcept
+      : QP::QActive(initial)
+    {}
+
+    //! one indexed call per state level (unhandled signals go to super)
+    template<QP::QSignal MAX_SIG_>
+    QP::QState jump(QSigJumpTbl<MAX_SIG_> const &tbl,
+                    QP::QEvt const * const e) noexcept
+    {
+        QP::QStateHandler const act = tbl.lookup(e->sig);
+        return (act != Q_STATE_CAST(0))
+               ? (*act)(this, e)
+               : super(tbl.superstate());
+    }
+};
+
+//............................................................................
+#ifndef DPP_CYCCNT
+    #include "em_device.h"  // for the DWT cycle counter (CMSIS)
+
+    //! free-running CPU cycle counter used by CycleMeter
+    #define DPP_CYCCNT() (DWT->CYCCNT)
+
+    //! enables the CPU cycle counter (called once, before measuring)
+    #define DPP_CYCCNT_INIT() do { \
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; \
+        DWT->CYCCNT = 0U; \
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk; \
+    } while (false)
+#endif // DPP_CYCCNT
+
+//! Wrapper accumulating the CPU cycles spent in dispatch() (see NOTE2)
+//!
+//! @tparam BASE_ the active object base class, such as QP::QActive,
+//! QP::QMActive, or DPP::QJumpActive
+//!
+template<class BASE_>
+class CycleMeter : public BASE_ {
+public:
+    std::uint32_t m_cycles;   //!< total cycles spent in dispatch()
+    std::uint32_t m_nEvts;    //!< number of dispatched events
+
+    //! average number of cycles per dispatched event
+    std::uint32_t cyclesPerEvt(void) const noexcept {
+        return (m_nEvts != 0U) ? (m_cycles / m_nEvts) : 0U;
+    }
+
+    void dispatch(QP::QEvt const * const e,
+                  std::uint_fast8_t const qs_id) override
+    {
+        std::uint32_t const t0 = DPP_CYCCNT();
+        BASE_::dispatch(e, qs_id);
+        m_cycles += DPP_CYCCNT() - t0;
+        ++m_nEvts;
+    }
+
+protected:
+    explicit CycleMeter(QP::QStateHandler const initial) noexcept
+      : BASE_(initial),
+        m_cycles(0U),
+        m_nEvts(0U)
+    {
+        DPP_CYCCNT_INIT();
+    }
+};
+
+} // namespace DPP
+
+//============================================================================
+// NOTE1:
+// The dense table trades RAM for speed: every state of every class using
+// QSigJumpTbl costs (MAX_SIG_ * sizeof(QStateHandler)) bytes, which is fine
+// for the few dozen signals typical of an application, but not for the
+// full QP::QSignal range. Because the tables are static objects, the sparse
+// maps are resolved during the static initialization at startup, before
+// main() and before QF::psInit() sets QF_maxPubSignal_. Therefore MAX_SIG_
+// must be a compile-time bound covering also the signals posted directly
+// and the internal signals (such as time events), not just the published
+// ones.
+//
+// The QEP_EMPTY_SIG_ (0) is never in the table, so that QEP discovers the
+// superstate of each state with the same single indexed call.
+//
+// NOTE2:
+// To compare the implementation strategies, use the same CycleMeter with
+// each of them: CycleMeter<QP::QActive> for the dpp_qhsm.qm model,
+// CycleMeter<QP::QMActive> for the dpp_qmsm.qm model (set as the superclass
+// of the Table AO in QM), and CycleMeter<QJumpActive> for table_jt.cpp.
+// The cycles include the framework overhead of QHsm::dispatch() (or
+// QMsm::dispatch()), but not the event queuing and scheduling.
+//
+
+#endif // JUMP_TBL_HPP
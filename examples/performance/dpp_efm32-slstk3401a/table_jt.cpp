@@ -0,0 +1,326 @@
+//============================================================================
+// Product: DPP example, Table AO with signal-indexed jump tables
+// Last updated for version 7.0.1
+// Last updated on  2022-05-20
+//
+//                    Q u a n t u m  L e a P s
+//                    ------------------------
+//                    Modern Embedded Software
+//
+// Copyright (C) 2005-2022 Quantum Leaps, LLC. All rights reserved.
+//
+// This program is open source software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Alternatively, this program may be distributed and modified under the
+// terms of Quantum Leaps commercial licenses, which expressly supersede
+// the GNU General Public License and are specifically designed for
+// licensees interested in retaining the proprietary status of their code.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <www.gnu.org/licenses/>.
+//
+// Contact information:
+// <www.state-machine.com/licensing>
+// <info@state-machine.com>
+//============================================================================
+// NOTE: this file is written by hand and replaces the generated table.cpp
+// in the build (see README.txt). The state machine is the same as in the
+// dpp_qhsm.qm/dpp_qmsm.qm models, but every state handler is a single call
+// through a signal-indexed jump table.
+//
+#include "qpcpp.hpp"
+#include "dpp.hpp"
+#include "bsp.hpp"
+#include "jump_tbl.hpp"
+
+Q_DEFINE_THIS_FILE
+
+// Active object class -------------------------------------------------------
+namespace DPP {
+
+typedef QSigJumpTbl<MAX_SIG> TableJumpTbl;
+
+class Table : public CycleMeter<QJumpActive> {
+private:
+    uint8_t m_fork[N_PHILO];
+    bool m_isHungry[N_PHILO];
+
+public:
+    Table();
+
+protected:
+    Q_STATE_DECL(initial);
+    Q_STATE_DECL(active);
+    Q_STATE_DECL(serving);
+    Q_STATE_DECL(paused);
+
+    // actions referenced from the jump tables
+    Q_STATE_DECL(active_TEST);
+    Q_STATE_DECL(active_EAT);
+    Q_STATE_DECL(serving_ENTRY);
+    Q_STATE_DECL(serving_HUNGRY);
+    Q_STATE_DECL(serving_DONE);
+    Q_STATE_DECL(serving_PAUSE);
+    Q_STATE_DECL(paused_ENTRY);
+    Q_STATE_DECL(paused_EXIT);
+    Q_STATE_DECL(paused_SERVE);
+    Q_STATE_DECL(paused_HUNGRY);
+    Q_STATE_DECL(paused_DONE);
+
+    // sparse signal-to-action maps and their dense jump tables
+    static TableJumpTbl::Entry const active_map[];
+    static TableJumpTbl::Entry const serving_map[];
+    static TableJumpTbl::Entry const paused_map[];
+    static TableJumpTbl const active_tbl;
+    static TableJumpTbl const serving_tbl;
+    static TableJumpTbl const paused_tbl;
+};
+
+// helper function to provide the RIGHT neighbour of a Philo[n]
+inline uint8_t RIGHT(uint8_t const n) {
+    return static_cast<uint8_t>((n + (N_PHILO - 1U)) % N_PHILO);
+}
+
+// helper function to provide the LEFT neighbour of a Philo[n]
+inline uint8_t LEFT(uint8_t const n) {
+    return static_cast<uint8_t>((n + 1U) % N_PHILO);
+}
+
+static uint8_t const FREE = static_cast<uint8_t>(0);
+static uint8_t const USED = static_cast<uint8_t>(1);
+
+static char const * const THINKING = &"thinking"[0];
+static char const * const HUNGRY   = &"hungry  "[0];
+static char const * const EATING   = &"eating  "[0];
+
+// Local objects -------------------------------------------------------------
+static Table l_table; // the single instance of the Table active object
+
+// Global-scope objects ------------------------------------------------------
+QP::QActive * const AO_Table = &l_table; // "opaque" AO pointer
+
+// Jump tables ---------------------------------------------------------------
+// sparse signal-to-action maps, resolved into dense tables at startup
+TableJumpTbl::Entry const Table::active_map[] = {
+    { TEST_SIG,        &Table::active_TEST    },
+    { EAT_SIG,         &Table::active_EAT     }
+};
+TableJumpTbl::Entry const Table::serving_map[] = {
+    { Q_ENTRY_SIG,     &Table::serving_ENTRY  },
+    { HUNGRY_SIG,      &Table::serving_HUNGRY },
+    { DONE_SIG,        &Table::serving_DONE   },
+    { EAT_SIG,         &Table::active_EAT     },
+    { PAUSE_SIG,       &Table::serving_PAUSE  }
+};
+TableJumpTbl::Entry const Table::paused_map[] = {
+    { Q_ENTRY_SIG,     &Table::paused_ENTRY   },
+    { Q_EXIT_SIG,      &Table::paused_EXIT    },
+    { SERVE_SIG,       &Table::paused_SERVE   },
+    { HUNGRY_SIG,      &Table::paused_HUNGRY  },
+    { DONE_SIG,        &Table::paused_DONE    }
+};
+
+TableJumpTbl const Table::active_tbl(
+    active_map, Q_DIM(active_map), &QP::QHsm::top);
+TableJumpTbl const Table::serving_tbl(
+    serving_map, Q_DIM(serving_map), &Table::active);
+TableJumpTbl const Table::paused_tbl(
+    paused_map, Q_DIM(paused_map), &Table::active);
+
+//............................................................................
+Table::Table()
+  : CycleMeter<QJumpActive>(Q_STATE_CAST(&Table::initial))
+{
+    for (uint8_t n = 0U; n < N_PHILO; ++n) {
+        m_fork[n] = FREE;
+        m_isHungry[n] = false;
+    }
+}
+
+// HSM definition ------------------------------------------------------------
+Q_STATE_DEF(Table, initial) {
+    (void)e; // suppress the compiler warning about unused parameter
+
+    QS_OBJ_DICTIONARY(&l_table);
+    QS_FUN_DICTIONARY(&QP::QHsm::top);
+    QS_FUN_DICTIONARY(&Table::initial);
+    QS_FUN_DICTIONARY(&Table::active);
+    QS_FUN_DICTIONARY(&Table::serving);
+    QS_FUN_DICTIONARY(&Table::paused);
+
+    QS_SIG_DICTIONARY(DONE_SIG,      nullptr); // global signals
+    QS_SIG_DICTIONARY(EAT_SIG,       nullptr);
+    QS_SIG_DICTIONARY(PAUSE_SIG,     nullptr);
+    QS_SIG_DICTIONARY(SERVE_SIG,     nullptr);
+    QS_SIG_DICTIONARY(TEST_SIG,      nullptr);
+
+    QS_SIG_DICTIONARY(HUNGRY_SIG,    this); // signal just for Table
+
+    subscribe(DONE_SIG);
+    subscribe(PAUSE_SIG);
+    subscribe(SERVE_SIG);
+    subscribe(TEST_SIG);
+
+    for (uint8_t n = 0U; n < N_PHILO; ++n) {
+        m_fork[n] = FREE;
+        m_isHungry[n] = false;
+        BSP::displayPhilStat(n, THINKING);
+    }
+    return tran(&serving);
+}
+//............................................................................
+Q_STATE_DEF(Table, active) {
+    return jump(active_tbl, e);
+}
+//............................................................................
+Q_STATE_DEF(Table, active_TEST) {
+    (void)e; // suppress the compiler warning about unused parameter
+    return Q_HANDLED();
+}
+//............................................................................
+Q_STATE_DEF(Table, active_EAT) {
+    (void)e; // suppress the compiler warning about unused parameter
+    Q_ERROR();
+    return Q_HANDLED();
+}
+//............................................................................
+Q_STATE_DEF(Table, serving) {
+    return jump(serving_tbl, e);
+}
+//............................................................................
+Q_STATE_DEF(Table, serving_ENTRY) {
+    (void)e; // suppress the compiler warning about unused parameter
+    for (uint8_t n = 0U; n < N_PHILO; ++n) { // give permissions to eat...
+        if (m_isHungry[n]
+            && (m_fork[LEFT(n)] == FREE)
+            && (m_fork[n] == FREE))
+        {
+            m_fork[LEFT(n)] = USED;
+            m_fork[n] = USED;
+            TableEvt *te = Q_NEW(TableEvt, EAT_SIG);
+            te->philoNum = n;
+            QP::QF::PUBLISH(te, this);
+            m_isHungry[n] = false;
+            BSP::displayPhilStat(n, EATING);
+        }
+    }
+    return Q_HANDLED();
+}
+//............................................................................
+Q_STATE_DEF(Table, serving_HUNGRY) {
+    uint8_t n = Q_EVT_CAST(TableEvt)->philoNum;
+    // phil ID must be in range and he must be not hungry
+    Q_ASSERT((n < N_PHILO) && (!m_isHungry[n]));
+
+    BSP::displayPhilStat(n, HUNGRY);
+    uint8_t m = LEFT(n);
+    if ((m_fork[m] == FREE) && (m_fork[n] == FREE)) {
+        m_fork[m] = USED;
+        m_fork[n] = USED;
+        TableEvt *pe = Q_NEW(TableEvt, EAT_SIG);
+        pe->philoNum = n;
+        QP::QF::PUBLISH(pe, this);
+        BSP::displayPhilStat(n, EATING);
+    }
+    else {
+        m_isHungry[n] = true;
+    }
+    return Q_HANDLED();
+}
+//............................................................................
+Q_STATE_DEF(Table, serving_DONE) {
+    uint8_t n = Q_EVT_CAST(TableEvt)->philoNum;
+    // phil ID must be in range and he must be not hungry
+    Q_ASSERT((n < N_PHILO) && (!m_isHungry[n]));
+
+    BSP::displayPhilStat(n, THINKING);
+    uint8_t m = LEFT(n);
+    // both forks of Phil[n] must be used
+    Q_ASSERT((m_fork[n] == USED) && (m_fork[m] == USED));
+
+    m_fork[m] = FREE;
+    m_fork[n] = FREE;
+    m = RIGHT(n); // check the right neighbor
+
+    if (m_isHungry[m] && (m_fork[m] == FREE)) {
+        m_fork[n] = USED;
+        m_fork[m] = USED;
+        m_isHungry[m] = false;
+        TableEvt *pe = Q_NEW(TableEvt, EAT_SIG);
+        pe->philoNum = m;
+        QP::QF::PUBLISH(pe, this);
+        BSP::displayPhilStat(m, EATING);
+    }
+    m = LEFT(n); // check the left neighbor
+    n = LEFT(m); // left fork of the left neighbor
+    if (m_isHungry[m] && (m_fork[n] == FREE)) {
+        m_fork[m] = USED;
+        m_fork[n] = USED;
+        m_isHungry[m] = false;
+        TableEvt *pe = Q_NEW(TableEvt, EAT_SIG);
+        pe->philoNum = m;
+        QP::QF::PUBLISH(pe, this);
+        BSP::displayPhilStat(m, EATING);
+    }
+    return Q_HANDLED();
+}
+//............................................................................
+Q_STATE_DEF(Table, serving_PAUSE) {
+    (void)e; // suppress the compiler warning about unused parameter
+    return tran(&paused);
+}
+//............................................................................
+Q_STATE_DEF(Table, paused) {
+    return jump(paused_tbl, e);
+}
+//............................................................................
+Q_STATE_DEF(Table, paused_ENTRY) {
+    (void)e; // suppress the compiler warning about unused parameter
+    BSP::displayPaused(1U);
+    return Q_HANDLED();
+}
+//............................................................................
+Q_STATE_DEF(Table, paused_EXIT) {
+    (void)e; // suppress the compiler warning about unused parameter
+    BSP::displayPaused(0U);
+    return Q_HANDLED();
+}
+//............................................................................
+Q_STATE_DEF(Table, paused_SERVE) {
+    (void)e; // suppress the compiler warning about unused parameter
+    return tran(&serving);
+}
+//............................................................................
+Q_STATE_DEF(Table, paused_HUNGRY) {
+    uint8_t n = Q_EVT_CAST(TableEvt)->philoNum;
+    // philo ID must be in range and he must be not hungry
+    Q_ASSERT((n < N_PHILO) && (!m_isHungry[n]));
+    m_isHungry[n] = true;
+    BSP::displayPhilStat(n, HUNGRY);
+    return Q_HANDLED();
+}
+//............................................................................
+Q_STATE_DEF(Table, paused_DONE) {
+    uint8_t n = Q_EVT_CAST(TableEvt)->philoNum;
+    // phil ID must be in range and he must be not hungry
+    Q_ASSERT((n < N_PHILO) && (!m_isHungry[n]));
+
+    BSP::displayPhilStat(n, THINKING);
+    uint8_t m = LEFT(n);
+    // both forks of Phil[n] must be used
+    Q_ASSERT((m_fork[n] == USED) && (m_fork[m] == USED));
+
+    m_fork[m] = FREE;
+    m_fork[n] = FREE;
+    return Q_HANDLED();
+}
+
+} // namespace DPP
@@ -0,0 +1,393 @@
+//============================================================================
+// Product: Event-posting throughput benchmark for the POSIX QP/C++ port
+// Last updated for version 7.0.1
+// Last updated on  2022-05-02
+//
+//                    Q u a n t u m  L e a P s
+//                    ------------------------
+//                    Modern Embedded Software
+//
+// Copyright (C) 2005-2022 Quantum Leaps, LLC. All rights reserved.
+//
+// This program is open source software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Alternatively, this program may be distributed and modified under the
+// terms of Quantum Leaps commercial licenses, which expressly supersede
+// the GNU General Public License and are specifically designed for
+// licensees interested in retaining the proprietary status of their code.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <www.gnu.org/licenses/>.
+//
+// Contact information:
+// <www.state-machine.com/licensing>
+// <info@state-machine.com>
+//============================================================================
+#include "qpcpp.hpp"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>  // for exit(), atoi()
+#include <time.h>
+#include <unistd.h>  // for getopt(), sysconf()
+
+using namespace QP;
+
+Q_DEFINE_THIS_FILE
+
+enum { BSP_TICKS_PER_SEC = 100 };
+enum { MAX_PRODUCERS = 16 };  // also the number of Sink active objects
+enum { SINK_QLEN = 256 };
+enum { PSET_SAMPLES = 1024 }; // number of random sets for the QPSet test
+
+enum BenchSignals {
+    BENCH_SIG = Q_USER_SIG,
+    FANOUT_SIG, // published to all subscribed Sinks
+    PUB_SIG,    // the first of the signals published by the producers
+    MAX_SIG = PUB_SIG + MAX_PRODUCERS
+};
+
+//............................................................................
+// Sink active object consumes all events posted to it
+class Sink : public QActive {
+public:
+    unsigned long volatile m_nRecv; // number of published events received
+
+    Sink() : QActive(Q_STATE_CAST(&Sink::initial)), m_nRecv(0U) {}
+
+protected:
+    Q_STATE_DECL(initial);
+    Q_STATE_DECL(active);
+};
+
+Q_STATE_DEF(Sink, initial) {
+    (void)e; // unused parameter
+    return tran(&active);
+}
+Q_STATE_DEF(Sink, active) {
+    QState status_;
+    switch (e->sig) {
+        case BENCH_SIG: {
+            status_ = Q_RET_HANDLED;
+            break;
+        }
+        case FANOUT_SIG: {
+            m_nRecv = m_nRecv + 1U;
+            status_ = Q_RET_HANDLED;
+            break;
+        }
+        default: {
+            if ((PUB_SIG <= e->sig) && (e->sig < MAX_SIG)) {
+                m_nRecv = m_nRecv + 1U;
+                status_ = Q_RET_HANDLED;
+            }
+            else {
+                status_ = super(&top);
+            }
+            break;
+        }
+    }
+    return status_;
+}
+
+//............................................................................
+// producer p-thread posting events to "its" Sink as fast as possible
+struct Producer {
+    pthread_t thread;
+    Sink *sink;
+    unsigned long nPosts;  // number of successful posts
+};
+
+static Sink l_sink[MAX_PRODUCERS];
+static Producer l_producer[MAX_PRODUCERS];
+static QEvt const l_benchEvt = { BENCH_SIG, 0U, 0U };
+static QEvt const l_fanoutEvt = { FANOUT_SIG, 0U, 0U };
+static QEvt l_pubEvt[MAX_PRODUCERS]; // published by the producers
+static bool volatile l_isMeasuring;
+
+// benchmark parameters (command-line options)
+static int  l_maxProducers;
+static int  l_msPerRun = 500;
+static bool l_dynamicEvts;
+static bool l_poolOnly;
+static bool l_fanout;
+static bool l_psetOnly;
+static bool l_publish;
+
+static void *producerThread(void *arg) {
+    Producer * const me = static_cast<Producer *>(arg);
+    unsigned long n = 0U;
+    while (l_isMeasuring && l_poolOnly) { // event-pool benchmark only?
+        QEvt const *e;
+        Q_NEW_X(e, QEvt, 0U, BENCH_SIG);
+        if (e != nullptr) {
+            QF::gc(e); // recycle the event right away
+            ++n;
+        }
+    }
+    Sink * const sink = me->sink;
+    unsigned long const recv0 = sink->m_nRecv;
+    while (l_isMeasuring && l_publish) { // publish to "its" Sink only?
+        // don't run more than half a queue ahead of the Sink
+        if ((n - (sink->m_nRecv - recv0)) < SINK_QLEN / 2) {
+            QF::PUBLISH(&l_pubEvt[me - &l_producer[0]], me);
+            ++n;
+        }
+        else {
+            sched_yield();
+        }
+    }
+    while (l_isMeasuring) {
+        QEvt const *e;
+        if (l_dynamicEvts) {
+            Q_NEW_X(e, QEvt, 1U, BENCH_SIG);
+        }
+        else {
+            e = &l_benchEvt;
+        }
+        if ((e != nullptr) && me->sink->POST_X(e, 1U, me)) {
+            ++n;
+        }
+        else { // pool or queue full, let the consumers catch up
+            sched_yield();
+        }
+    }
+    me->nPosts = n;
+    return nullptr;
+}
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<double>(ts.tv_sec)
+           + static_cast<double>(ts.tv_nsec)*1e-9;
+}
+
+// QPSet operations on random sets of QF_MAX_ACTIVE elements
+static void psetBenchmark(void) {
+    static QPSet set[PSET_SAMPLES];
+    srand(1U);
+    for (int i = 0; i < PSET_SAMPLES; ++i) {
+        set[i].setEmpty();
+        for (unsigned n = 1U; n <= QF_MAX_ACTIVE; ++n) {
+            if ((rand() & 7) == 0) { // about 1/8 of the elements
+                set[i].insert(static_cast<std::uint_fast8_t>(n));
+            }
+        }
+    }
+    printf("QPSet of %u elements (%u bytes)\n",
+           static_cast<unsigned>(QF_MAX_ACTIVE),
+           static_cast<unsigned>(sizeof(QPSet)));
+
+    enum { ROUNDS = 20000 };
+    unsigned long sum = 0U;
+    double t0 = now();
+    for (int r = 0; r < ROUNDS; ++r) {
+        for (int i = 0; i < PSET_SAMPLES; ++i) {
+            sum += set[i].findMax();
+        }
+    }
+    double const tMax = now() - t0;
+
+    unsigned long nElems = 0U;
+    t0 = now();
+    for (int r = 0; r < ROUNDS / 10; ++r) {
+        for (int i = 0; i < PSET_SAMPLES; ++i) {
+            for (std::uint_fast8_t p = set[i].findMax(); p != 0U;
+                 p = set[i].findMaxBelow(p))
+            {
+                sum += p;
+                ++nElems;
+            }
+        }
+    }
+    double const tIter = now() - t0;
+
+    // the same iteration as in QF::publish_() before findMaxBelow():
+    // remove the maximum element from a copy of the set until it is empty
+    t0 = now();
+    for (int r = 0; r < ROUNDS / 10; ++r) {
+        for (int i = 0; i < PSET_SAMPLES; ++i) {
+            QPSet tmp = set[i];
+            while (tmp.notEmpty()) {
+                std::uint_fast8_t const p = tmp.findMax();
+                sum += p;
+                tmp.rmove(p);
+            }
+        }
+    }
+    double const tRmove = now() - t0;
+
+    printf("findMax       %6.2f ns\n",
+           tMax * 1e9 / (static_cast<double>(ROUNDS) * PSET_SAMPLES));
+    printf("iterate       %6.2f ns/element (findMaxBelow)\n",
+           tIter * 1e9 / static_cast<double>(nElems));
+    printf("iterate       %6.2f ns/element (findMax + rmove on a copy)\n",
+           tRmove * 1e9 / static_cast<double>(nElems));
+    printf("(checksum %lu)\n", sum);
+}
+
+// publish static events to 1..MAX_PRODUCERS subscribed Sinks
+static void fanoutBenchmark(void) {
+    printf("publish fan-out (%d ms per run)\n", l_msPerRun);
+    printf("subscribers   publish/sec   deliveries/sec\n");
+    for (int n = 1; n <= MAX_PRODUCERS; ++n) {
+        l_sink[n - 1].subscribe(FANOUT_SIG);
+        unsigned long recv0[MAX_PRODUCERS];
+        for (int i = 0; i < n; ++i) {
+            recv0[i] = l_sink[i].m_nRecv;
+        }
+        unsigned long nPub = 0U;
+        l_isMeasuring = true;
+        double const t0 = now();
+        double const tEnd = t0 + l_msPerRun * 1e-3;
+        while (now() < tEnd) {
+            // don't run more than half a queue ahead of the slowest Sink
+            unsigned long lag = 0U;
+            for (int i = 0; i < n; ++i) {
+                unsigned long const d = nPub - (l_sink[i].m_nRecv - recv0[i]);
+                if (lag < d) {
+                    lag = d;
+                }
+            }
+            if (lag < SINK_QLEN / 2) {
+                for (int k = 0; k < SINK_QLEN / 4; ++k) {
+                    QF::PUBLISH(&l_fanoutEvt, nullptr);
+                }
+                nPub += SINK_QLEN / 4;
+            }
+            else {
+                sched_yield();
+            }
+        }
+        double const rate = static_cast<double>(nPub) / (now() - t0);
+        l_isMeasuring = false;
+        printf("%11d %13.0f %16.0f\n", n, rate, rate * n);
+    }
+}
+
+// driver p-thread running the benchmark for 1..l_maxProducers producers
+static void *driverThread(void *arg) {
+    (void)arg; // unused parameter
+
+    if (l_psetOnly) {
+        psetBenchmark();
+        QF::stop(); // terminate the QF::run() loop
+        return nullptr;
+    }
+    if (l_fanout) {
+        fanoutBenchmark();
+        QF::stop(); // terminate the QF::run() loop
+        return nullptr;
+    }
+    if (l_publish) {
+        for (int i = 0; i < l_maxProducers; ++i) {
+            l_sink[i].subscribe(PUB_SIG + i);
+        }
+        printf("publish throughput (%d ms per run)\n", l_msPerRun);
+    }
+    else if (l_poolOnly) {
+        printf("event-pool throughput (%d ms per run)\n", l_msPerRun);
+    }
+    else {
+        printf("post throughput (%s events, %d ms per run)\n",
+               l_dynamicEvts ? "dynamic" : "static", l_msPerRun);
+    }
+    char const * const op = l_poolOnly ? "alloc"
+                            : (l_publish ? "pubs " : "posts");
+    printf("producers   %s/sec   %s/sec/producer\n", op, op);
+    for (int n = 1; n <= l_maxProducers; ++n) {
+        l_isMeasuring = true;
+        for (int i = 0; i < n; ++i) {
+            l_producer[i].sink   = &l_sink[i];
+            l_producer[i].nPosts = 0U;
+            pthread_create(&l_producer[i].thread, nullptr,
+                           &producerThread, &l_producer[i]);
+        }
+        double const t0 = now();
+        usleep(static_cast<useconds_t>(l_msPerRun) * 1000U);
+        l_isMeasuring = false;
+        unsigned long total = 0U;
+        for (int i = 0; i < n; ++i) {
+            pthread_join(l_producer[i].thread, nullptr);
+            total += l_producer[i].nPosts;
+        }
+        double const rate = static_cast<double>(total) / (now() - t0);
+        printf("%9d %11.0f %20.0f\n", n, rate, rate / n);
+    }
+    QF::stop(); // terminate the QF::run() loop
+    return nullptr;
+}
+
+//............................................................................
+int main(int argc, char *argv[]) {
+    static QEvt const *sinkQueueSto[MAX_PRODUCERS][SINK_QLEN];
+    static QF_MPOOL_EL(QEvt) smlPoolSto[MAX_PRODUCERS*SINK_QLEN];
+    static QSubscrList subscrSto[MAX_SIG];
+
+    l_maxProducers = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+    int opt;
+    while ((opt = getopt(argc, argv, "dpfmsn:t:")) != -1) {
+        switch (opt) {
+            case 'd': l_dynamicEvts = true; break;
+            case 'p': l_poolOnly = true; break;
+            case 'f': l_fanout = true; break;
+            case 'm': l_psetOnly = true; break;
+            case 's': l_publish = true; break;
+            case 'n': l_maxProducers = atoi(optarg); break;
+            case 't': l_msPerRun = atoi(optarg); break;
+            default:
+                fprintf(stderr,
+                        "usage: %s [-d] [-p] [-f] [-m] [-s] [-n producers]"
+                        " [-t ms]\n",
+                        argv[0]);
+                return -1;
+        }
+    }
+    if (l_maxProducers < 1) {
+        l_maxProducers = 1;
+    }
+    else if (l_maxProducers > MAX_PRODUCERS) {
+        l_maxProducers = MAX_PRODUCERS;
+    }
+
+    QF::init(); // initialize the framework
+    QF::psInit(subscrSto, Q_DIM(subscrSto)); // init publish-subscribe
+    QF::poolInit(smlPoolSto, sizeof(smlPoolSto), sizeof(smlPoolSto[0]));
+
+    for (int i = 0; i < MAX_PRODUCERS; ++i) {
+        l_pubEvt[i].sig     = static_cast<QSignal>(PUB_SIG + i);
+        l_pubEvt[i].poolId_ = 0U;
+        l_pubEvt[i].refCtr_ = 0U;
+        l_sink[i].start(static_cast<std::uint_fast8_t>(i + 1),
+                        sinkQueueSto[i], Q_DIM(sinkQueueSto[i]),
+                        nullptr, 0U);
+    }
+    return QF::run(); // run the QF application
+}
+
+//............................................................................
+void QF::onStartup(void) {
+    QF_setTickRate(BSP_TICKS_PER_SEC, 30); // set the desired tick rate
+
+    pthread_t driver;
+    pthread_create(&driver, nullptr, &driverThread, nullptr);
+    pthread_detach(driver);
+}
+void QF::onCleanup(void) {}
+void QP::QF_onClockTick(void) {
+    QF::TICK_X(0U, nullptr);  // perform the QF clock tick processing
+}
+extern "C" void Q_onAssert(char const * const module, int loc) {
+    fprintf(stderr, "Assertion failed in %s:%d\n", module, loc);
+    exit(-1);
+}
@@ -65,6 +65,15 @@ int main(int argc, char *argv[ ]) {
     QS_GLB_FILTER(QP::QS_ALL_RECORDS);
     QS_GLB_FILTER(-QP::QS_QF_TICK);
 
+#ifdef QHSM_TRAN_CACHE
+    static QHsmTranCache l_tranCache; // memo of the transition paths
+    the_sm->setTranCache(&l_tranCache);
+#endif
+#ifdef QHSM_STATE_TABLE
+    static QHsmStateTable l_stateTable; // parents of the states
+    the_sm->setStateTable(&l_stateTable);
+#endif
+
     if (argc > 1) { // file name provided?
         l_outFile = fopen(argv[1], "w");
     }
@@ -101,6 +110,7 @@ int main(int argc, char *argv[ ]) {
             }
 
             the_sm->dispatch(&e, 0U); // dispatch the event
+            QHsmTst_displayConfig();
         }
     }
     else { // batch version
@@ -109,29 +119,34 @@ int main(int argc, char *argv[ ]) {
                 "QHsmTst example, QEP %s\n", QP::QEP::getVersion());
 
         the_sm->init(0U); // trigger the initial tran. in the test HSM
-
-        // dynamic transitions
-        dispatch(A_SIG);
-        dispatch(B_SIG);
-        dispatch(D_SIG);
-        dispatch(E_SIG);
-        dispatch(I_SIG);
-        dispatch(F_SIG);
-        dispatch(I_SIG);
-        dispatch(I_SIG);
-        dispatch(F_SIG);
-        dispatch(A_SIG);
-        dispatch(B_SIG);
-        dispatch(D_SIG);
-        dispatch(D_SIG);
-        dispatch(E_SIG);
-        dispatch(G_SIG);
-        dispatch(H_SIG);
-        dispatch(H_SIG);
-        dispatch(C_SIG);
-        dispatch(G_SIG);
-        dispatch(C_SIG);
-        dispatch(C_SIG);
+        QHsmTst_displayConfig();
+
+        // dynamic transitions, all taken twice to test also the replay of
+        // the memoized transitions (QHSM_TRAN_CACHE)
+        for (int pass = 0; pass < 2; ++pass) {
+            dispatch(IGNORE_SIG); // unhandled in all states up to top
+            dispatch(A_SIG);
+            dispatch(B_SIG);
+            dispatch(D_SIG);
+            dispatch(E_SIG);
+            dispatch(I_SIG);
+            dispatch(F_SIG);
+            dispatch(I_SIG);
+            dispatch(I_SIG);
+            dispatch(F_SIG);
+            dispatch(A_SIG);
+            dispatch(B_SIG);
+            dispatch(D_SIG);
+            dispatch(D_SIG);
+            dispatch(E_SIG);
+            dispatch(G_SIG);
+            dispatch(H_SIG);
+            dispatch(H_SIG);
+            dispatch(C_SIG);
+            dispatch(G_SIG);
+            dispatch(C_SIG);
+            dispatch(C_SIG);
+        }
 
         fclose(l_outFile);
     }
@@ -158,10 +173,12 @@ extern "C" Q_NORETURN Q_onAssert(char const * const file, int_t const  line) {
 }
 //............................................................................
 static void dispatch(QP::QSignal sig) {
-    Q_REQUIRE((A_SIG <= sig) && (sig <= I_SIG));
-    FPRINTF_S(l_outFile, "\n%c:", 'A' + sig - A_SIG);
+    Q_REQUIRE(((A_SIG <= sig) && (sig <= I_SIG)) || (sig == IGNORE_SIG));
+    FPRINTF_S(l_outFile, "\n%c:",
+              (sig == IGNORE_SIG) ? 'X' : ('A' + sig - A_SIG));
     QP::QEvt e = QEVT_INITIALIZER(sig);
     the_sm->dispatch(&e, 0U); // dispatch the event
+    QHsmTst_displayConfig();
     QS_OUTPUT(); // handle the QS output
 }
 
@@ -30,6 +30,10 @@ public:
       : QHsm(Q_STATE_CAST(&QHsmTst::initial))
     {}
 
+    // display the active state configuration found with childState()
+    // and the states for which isIn() is true
+    void displayConfig();
+
 protected:
     Q_STATE_DECL(initial);
     Q_STATE_DECL(s);
@@ -46,6 +50,10 @@ static QHsmTst l_sm; // the only instance of the QHsmTst class
 // global-scope definitions -----------------------------------------
 QP::QHsm * const the_sm = &l_sm; // the opaque pointer
 
+void QHsmTst_displayConfig(void) {
+    l_sm.displayConfig();
+}
+
 //.$skip${QP_VERSION} vvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv
 //. Check for the minimum required QP version
 #if (QP_VERSION < 690U) || (QP_VERSION != ((QP_RELEASE^4294967295U) % 0x3E8U))
@@ -54,6 +62,45 @@ QP::QHsm * const the_sm = &l_sm; // the opaque pointer
 //.$endskip${QP_VERSION} ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
 //.$define${HSMs::QHsmTst} vvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv
 //.${HSMs::QHsmTst} ..........................................................
+
+// display the active state configuration found with childState()
+// and the states for which isIn() is true
+//.${HSMs::QHsmTst::displayConfig} ...........................................
+void QHsmTst::displayConfig() {
+    static struct {
+        QP::QStateHandler state;
+        char const *name;
+    } const names[] = {
+        { Q_STATE_CAST(&QHsmTst::s),    "s"    },
+        { Q_STATE_CAST(&QHsmTst::s1),   "s1"   },
+        { Q_STATE_CAST(&QHsmTst::s11),  "s11"  },
+        { Q_STATE_CAST(&QHsmTst::s2),   "s2"   },
+        { Q_STATE_CAST(&QHsmTst::s21),  "s21"  },
+        { Q_STATE_CAST(&QHsmTst::s211), "s211" }
+    };
+
+    // the active states top-down, each one the child of the previous one
+    BSP_display(" @top");
+    QP::QStateHandler parent = &top;
+    while (parent != state()) {
+        parent = childState(parent);
+        for (auto const &n : names) {
+            if (n.state == parent) {
+                BSP_display("/");
+                BSP_display(n.name);
+            }
+        }
+    }
+
+    // the states for which isIn() is true
+    BSP_display(" isIn:");
+    for (auto const &n : names) {
+        if (isIn(n.state)) {
+            BSP_display(" ");
+            BSP_display(n.name);
+        }
+    }
+}
 //.${HSMs::QHsmTst::SM} ......................................................
 Q_STATE_DEF(QHsmTst, initial) {
     //.${HSMs::QHsmTst::SM::initial}
@@ -36,6 +36,9 @@ enum QHsmTstSignals {
 
 extern QP::QHsm * const the_sm; // opaque pointer to the test state machine
 
+// display the active state configuration of the test state machine
+void QHsmTst_displayConfig(void);
+
 // BSP functions to dispaly a message and exit
 void BSP_display(char const *msg);
 void BSP_terminate(int16_t const result);
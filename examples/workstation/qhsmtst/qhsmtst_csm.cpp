@@ -0,0 +1,278 @@
+//============================================================================
+// Product: QHsmTst Example, state machine flattened at compile time
+// Last updated for version 7.0.1
+// Last updated on  2022-05-20
+//
+//                    Q u a n t u m  L e a P s
+//                    ------------------------
+//                    Modern Embedded Software
+//
+// Copyright (C) 2005-2022 Quantum Leaps, LLC. All rights reserved.
+//
+// This program is open source software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Alternatively, this program may be distributed and modified under the
+// terms of Quantum Leaps commercial licenses, which expressly supersede
+// the GNU General Public License and are specifically designed for
+// licensees interested in retaining the proprietary status of their code.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <www.gnu.org/licenses/>.
+//
+// Contact information:
+// <www.state-machine.com/licensing>
+// <info@state-machine.com>
+//============================================================================
+// NOTE: this file is written by hand and replaces the generated qhsmtst.cpp
+// in the build with QHSM_CONSTEXPR (make HSM=csm). The state machine is the
+// same as in the qhsmtst.qm model, but it is specified as the tables of
+// states and transitions of a QP::QConstexprSm, so the batch test must
+// produce the same output (log.txt) as the QP::QHsm version.
+//
+#include "qpcpp.hpp"
+#include "qhsmtst.hpp"
+
+#ifndef QHSM_CONSTEXPR
+    #error "qhsmtst_csm.cpp requires QHSM_CONSTEXPR"
+#endif
+
+using QP::QCsm;
+using QP::QCsmState;
+using QP::QCsmTran;
+using QP::QEvt;
+
+class QHsmTst;
+
+namespace {
+
+// indices of the states in QHsmTstSpec::state[]
+enum QHsmTstStates : std::uint8_t { S, S1, S11, S2, S21, S211, N_STATE };
+
+// names of the states in the order of QHsmTstStates
+char const * const l_stateName[N_STATE] {
+    "s", "s1", "s11", "s2", "s21", "s211"
+};
+
+// actions and guards ........................................................
+void top_initial(void * const me, QEvt const * const e);
+void s_I(void * const me, QEvt const * const e);
+bool s_I_guard(void * const me, QEvt const * const e);
+void s_TERMINATE(void * const me, QEvt const * const e);
+void s1_D(void * const me, QEvt const * const e);
+bool s1_D_guard(void * const me, QEvt const * const e);
+void s11_D(void * const me, QEvt const * const e);
+bool s11_D_guard(void * const me, QEvt const * const e);
+void s2_I(void * const me, QEvt const * const e);
+bool s2_I_guard(void * const me, QEvt const * const e);
+
+// actions that only display their name
+#define QHSMTST_DISPLAY(act_, msg_) \
+    void act_(void * const, QEvt const * const) { BSP_display(msg_); }
+
+QHSMTST_DISPLAY(s_entry,    "s-ENTRY;")
+QHSMTST_DISPLAY(s_exit,     "s-EXIT;")
+QHSMTST_DISPLAY(s_initial,  "s-INIT;")
+QHSMTST_DISPLAY(s_E,        "s-E;")
+QHSMTST_DISPLAY(s1_entry,   "s1-ENTRY;")
+QHSMTST_DISPLAY(s1_exit,    "s1-EXIT;")
+QHSMTST_DISPLAY(s1_initial, "s1-INIT;")
+QHSMTST_DISPLAY(s1_I,       "s1-I;")
+QHSMTST_DISPLAY(s1_A,       "s1-A;")
+QHSMTST_DISPLAY(s1_B,       "s1-B;")
+QHSMTST_DISPLAY(s1_F,       "s1-F;")
+QHSMTST_DISPLAY(s1_C,       "s1-C;")
+QHSMTST_DISPLAY(s11_entry,  "s11-ENTRY;")
+QHSMTST_DISPLAY(s11_exit,   "s11-EXIT;")
+QHSMTST_DISPLAY(s11_H,      "s11-H;")
+QHSMTST_DISPLAY(s11_G,      "s11-G;")
+QHSMTST_DISPLAY(s2_entry,   "s2-ENTRY;")
+QHSMTST_DISPLAY(s2_exit,    "s2-EXIT;")
+QHSMTST_DISPLAY(s2_initial, "s2-INIT;")
+QHSMTST_DISPLAY(s2_F,       "s2-F;")
+QHSMTST_DISPLAY(s2_C,       "s2-C;")
+QHSMTST_DISPLAY(s21_entry,  "s21-ENTRY;")
+QHSMTST_DISPLAY(s21_exit,   "s21-EXIT;")
+QHSMTST_DISPLAY(s21_initial, "s21-INIT;")
+QHSMTST_DISPLAY(s21_G,      "s21-G;")
+QHSMTST_DISPLAY(s21_A,      "s21-A;")
+QHSMTST_DISPLAY(s21_B,      "s21-B;")
+QHSMTST_DISPLAY(s211_entry, "s211-ENTRY;")
+QHSMTST_DISPLAY(s211_exit,  "s211-EXIT;")
+QHSMTST_DISPLAY(s211_H,     "s211-H;")
+QHSMTST_DISPLAY(s211_D,     "s211-D;")
+
+#undef QHSMTST_DISPLAY
+
+} // unnamed namespace
+
+// specification of the QHsmTst state machine --------------------------------
+struct QHsmTstSpec {
+    static constexpr QCsmState state[N_STATE] {
+        //  parent    init        entry        exit        initAct
+        { QCsm::TOP, S11,        &s_entry,    &s_exit,    &s_initial   },
+        { S,         S11,        &s1_entry,   &s1_exit,   &s1_initial  },
+        { S1,        QCsm::NONE, &s11_entry,  &s11_exit,  nullptr      },
+        { S,         S211,       &s2_entry,   &s2_exit,   &s2_initial  },
+        { S2,        S211,       &s21_entry,  &s21_exit,  &s21_initial },
+        { S21,       QCsm::NONE, &s211_entry, &s211_exit, nullptr      }
+    };
+    static constexpr QCsmTran tran[] {
+        // source signal         target      guard         action
+        { S,    I_SIG,         QCsm::NONE, &s_I_guard,   &s_I         },
+        { S,    E_SIG,         S11,        nullptr,      &s_E         },
+        { S,    TERMINATE_SIG, QCsm::NONE, nullptr,      &s_TERMINATE },
+        { S1,   I_SIG,         QCsm::NONE, nullptr,      &s1_I        },
+        { S1,   D_SIG,         S,          &s1_D_guard,  &s1_D        },
+        { S1,   A_SIG,         S1,         nullptr,      &s1_A        },
+        { S1,   B_SIG,         S11,        nullptr,      &s1_B        },
+        { S1,   F_SIG,         S211,       nullptr,      &s1_F        },
+        { S1,   C_SIG,         S2,         nullptr,      &s1_C        },
+        { S11,  H_SIG,         S,          nullptr,      &s11_H       },
+        { S11,  D_SIG,         S1,         &s11_D_guard, &s11_D       },
+        { S11,  G_SIG,         S211,       nullptr,      &s11_G       },
+        { S2,   I_SIG,         QCsm::NONE, &s2_I_guard,  &s2_I        },
+        { S2,   F_SIG,         S11,        nullptr,      &s2_F        },
+        { S2,   C_SIG,         S1,         nullptr,      &s2_C        },
+        { S21,  G_SIG,         S1,         nullptr,      &s21_G       },
+        { S21,  A_SIG,         S21,        nullptr,      &s21_A       },
+        { S21,  B_SIG,         S211,       nullptr,      &s21_B       },
+        { S211, H_SIG,         S,          nullptr,      &s211_H      },
+        { S211, D_SIG,         S21,        nullptr,      &s211_D      }
+    };
+    static constexpr QCsmTran init {
+        QCsm::TOP, 0U, S2, nullptr, &top_initial
+    };
+};
+
+// definitions of the static constexpr members (needed in C++11)
+constexpr QCsmState QHsmTstSpec::state[N_STATE];
+constexpr QCsmTran  QHsmTstSpec::tran[];
+constexpr QCsmTran  QHsmTstSpec::init;
+
+//............................................................................
+class QHsmTst : public QP::QConstexprSm<QHsmTstSpec> {
+public:
+    bool m_foo; // extended state variable (used by the actions and guards)
+
+    QHsmTst()
+      : m_foo(false)
+    {}
+
+    // display the active state configuration and the states for which
+    // isInState() is true, in the same format as the QP::QHsm version
+    void displayConfig();
+};
+
+static QHsmTst l_sm; // the only instance of the QHsmTst class
+
+// global-scope definitions -----------------------------------------
+QP::QHsm * const the_sm = &l_sm; // the opaque pointer
+
+void QHsmTst_displayConfig(void) {
+    l_sm.displayConfig();
+}
+
+//............................................................................
+void QHsmTst::displayConfig() {
+    // the active states top-down: walk the parents up from the leaf state
+    // and display them in the reverse order
+    std::uint8_t path[N_STATE];
+    std::uint_fast8_t depth = 0U;
+    for (std::uint8_t s = stateIdx(); s != QCsm::TOP;
+         s = QHsmTstSpec::state[s].parent)
+    {
+        path[depth] = s;
+        ++depth;
+    }
+    BSP_display(" @top");
+    while (depth > 0U) {
+        --depth;
+        BSP_display("/");
+        BSP_display(l_stateName[path[depth]]);
+    }
+
+    // the states for which isInState() is true
+    BSP_display(" isIn:");
+    for (std::uint8_t s = 0U; s < N_STATE; ++s) {
+        if (isInState(s)) {
+            BSP_display(" ");
+            BSP_display(l_stateName[s]);
+        }
+    }
+}
+
+namespace {
+
+//............................................................................
+void top_initial(void * const me, QEvt const * const e) {
+    (void)e; // unused parameter
+    static_cast<QHsmTst *>(me)->m_foo = false;
+    BSP_display("top-INIT;");
+
+    QS_FUN_DICTIONARY(&QHsmTstSpec::state[S]);
+    QS_FUN_DICTIONARY(&QHsmTstSpec::state[S1]);
+    QS_FUN_DICTIONARY(&QHsmTstSpec::state[S11]);
+    QS_FUN_DICTIONARY(&QHsmTstSpec::state[S2]);
+    QS_FUN_DICTIONARY(&QHsmTstSpec::state[S21]);
+    QS_FUN_DICTIONARY(&QHsmTstSpec::state[S211]);
+}
+//............................................................................
+bool s_I_guard(void * const me, QEvt const * const e) {
+    (void)e; // unused parameter
+    return static_cast<QHsmTst *>(me)->m_foo;
+}
+//............................................................................
+void s_I(void * const me, QEvt const * const e) {
+    (void)e; // unused parameter
+    static_cast<QHsmTst *>(me)->m_foo = false;
+    BSP_display("s-I;");
+}
+//............................................................................
+void s_TERMINATE(void * const me, QEvt const * const e) {
+    (void)me; // unused parameter
+    (void)e;  // unused parameter
+    BSP_terminate(0);
+}
+//............................................................................
+bool s1_D_guard(void * const me, QEvt const * const e) {
+    (void)e; // unused parameter
+    return !static_cast<QHsmTst *>(me)->m_foo;
+}
+//............................................................................
+void s1_D(void * const me, QEvt const * const e) {
+    (void)e; // unused parameter
+    static_cast<QHsmTst *>(me)->m_foo = true;
+    BSP_display("s1-D;");
+}
+//............................................................................
+bool s11_D_guard(void * const me, QEvt const * const e) {
+    (void)e; // unused parameter
+    return static_cast<QHsmTst *>(me)->m_foo;
+}
+//............................................................................
+void s11_D(void * const me, QEvt const * const e) {
+    (void)e; // unused parameter
+    static_cast<QHsmTst *>(me)->m_foo = false;
+    BSP_display("s11-D;");
+}
+//............................................................................
+bool s2_I_guard(void * const me, QEvt const * const e) {
+    (void)e; // unused parameter
+    return !static_cast<QHsmTst *>(me)->m_foo;
+}
+//............................................................................
+void s2_I(void * const me, QEvt const * const e) {
+    (void)e; // unused parameter
+    static_cast<QHsmTst *>(me)->m_foo = true;
+    BSP_display("s2-I;");
+}
+
+} // unnamed namespace
@@ -56,6 +56,26 @@
     #define Q_SIGNAL_SIZE 2U
 #endif
 
+#ifdef QHSM_TRAN_CACHE
+    //! The macro QHSM_TRAN_CACHE (if defined in qep_port.hpp or on the
+    //! command line) enables the memo of transition paths of the QP::QHsm
+    //! state machines (see QP::QHsmTranCache) and specifies the number of
+    //! transition paths memoized in every cache. Valid values: [1U..255U]
+    #if (QHSM_TRAN_CACHE < 1U) || (QHSM_TRAN_CACHE > 255U)
+        #error "QHSM_TRAN_CACHE must be in the range 1U..255U"
+    #endif
+#endif
+
+#ifdef QHSM_STATE_TABLE
+    //! The macro QHSM_STATE_TABLE (if defined in qep_port.hpp or on the
+    //! command line) enables the tables of state parents of the QP::QHsm
+    //! state machines (see QP::QHsmStateTable) and specifies the number of
+    //! states in every table. Valid values: [1U..255U]
+    #if (QHSM_STATE_TABLE < 1U) || (QHSM_STATE_TABLE > 255U)
+        #error "QHSM_STATE_TABLE must be in the range 1U..255U"
+    #endif
+#endif
+
 //============================================================================
 // Aliases for basic numerical types; MISRA-C++ 2008 rule 3-9-2(req).
 
@@ -175,6 +195,10 @@ namespace QP {
         friend std::uint8_t QF_EVT_REF_CTR_ (QEvt const * const e) noexcept;
         friend void QF_EVT_REF_CTR_INC_(QEvt const * const e) noexcept;
         friend void QF_EVT_REF_CTR_DEC_(QEvt const * const e) noexcept;
+#ifdef QF_EVT_REF_ATOMIC
+        friend std::uint8_t QF_EVT_REF_CTR_RELEASE_(QEvt const * const e)
+            noexcept;
+#endif
     };
 
 #else // QEvt is a POD (Plain Old Datatype)
@@ -200,6 +224,12 @@ namespace QP {
 struct QMState;
 struct QMTranActTable;
 class QXThread;
+#ifdef QHSM_TRAN_CACHE
+class QHsmTranCache;
+#endif
+#ifdef QHSM_STATE_TABLE
+class QHsmStateTable;
+#endif
 
 //! Type returned from state-handler functions
 using QState = std::uint_fast8_t;
@@ -250,6 +280,16 @@ class QHsm {
     QHsmAttr m_state;  //!< current active state (state-variable)
     QHsmAttr m_temp;   //!< temporary: transition chain, target state, etc.
 
+#ifdef QHSM_TRAN_CACHE
+    //! memo of the transition paths of this state machine (might be NULL)
+    QHsmTranCache *m_tranCache;
+#endif
+
+#ifdef QHSM_STATE_TABLE
+    //! table of the state parents of this state machine (might be NULL)
+    QHsmStateTable *m_stateTable;
+#endif
+
 public:
     //! virtual destructor
     virtual ~QHsm();
@@ -284,6 +324,22 @@ public:
     //! the top-state.
     static QState top(void * const me, QEvt const * const e) noexcept;
 
+#ifdef QHSM_TRAN_CACHE
+    //! Attach the memo of transition paths to this state machine
+    //! @note the cache can be shared by all instances of the same class
+    void setTranCache(QHsmTranCache * const cache) noexcept {
+        m_tranCache = cache;
+    }
+#endif
+
+#ifdef QHSM_STATE_TABLE
+    //! Attach the table of state parents to this state machine
+    //! @note the table can be shared by all instances of the same class
+    void setStateTable(QHsmStateTable * const table) noexcept {
+        m_stateTable = table;
+    }
+#endif
+
 protected:
     //! Protected constructor of QHsm.
     explicit QHsm(QStateHandler const initial) noexcept;
@@ -446,6 +502,23 @@ private:
     std::int_fast8_t hsm_tran(QStateHandler (&path)[MAX_NEST_DEPTH_],
                               std::uint_fast8_t const qs_id);
 
+#ifdef QHSM_TRAN_CACHE
+    //! internal helper function to take a transition in QP::QHsm
+    //! through the memo of transition paths
+    std::int_fast8_t hsm_tranCached(QStateHandler (&path)[MAX_NEST_DEPTH_],
+                                    std::uint_fast8_t const qs_id);
+
+    friend class QHsmTranCache;
+#endif
+
+#ifdef QHSM_STATE_TABLE
+    //! internal helper function to find the superstate of a state
+    //! through the table of state parents
+    QState hsm_super(QStateHandler const s);
+
+    friend class QHsmStateTable;
+#endif
+
     friend class QMsm;
     friend class QActive;
     friend class QMActive;
@@ -461,6 +534,110 @@ private:
 #endif // Q_UTEST
 };
 
+#ifdef QHSM_TRAN_CACHE
+//============================================================================
+//! Memo of the transition paths of a QP::QHsm subclass
+//! @description
+//! The exit and entry path of a transition depends only on the current
+//! state, the source, and the target of the transition, because the state
+//! hierarchy of a QP::QHsm is fixed. QHsmTranCache memoizes these paths the
+//! first time a transition is taken, so that the subsequent transitions
+//! skip the discovery of the least common ancestor (LCA) and execute only
+//! the exit and entry actions. The cache is typically a static object
+//! shared by all instances of a QP::QHsm subclass and attached to them with
+//! QP::QHsm::setTranCache(). When the cache is full, the transitions not
+//! memoized yet are taken without the cache.
+//!
+//! @note
+//! The cache can be shared by state machines running in different threads,
+//! because the entries are claimed and published atomically (with the GCC
+//! atomic builtins). The memoized entries are never evicted.
+//!
+class QHsmTranCache {
+public:
+    //! the default constructor (empty cache)
+    QHsmTranCache() noexcept;
+
+private:
+    //! memoized transition path
+    struct Entry {
+        QStateHandler leaf; //!< current state when the transition was taken
+        QStateHandler src;  //!< source of the transition
+        QStateHandler tgt;  //!< target of the transition
+        QStateHandler exit[QHsm::MAX_NEST_DEPTH_];  //!< states to exit
+        QStateHandler entry[QHsm::MAX_NEST_DEPTH_]; //!< entry path (reversed)
+        std::uint8_t nExit;  //!< number of states to exit
+        std::uint8_t nEntry; //!< number of states to enter
+        std::uint8_t state;  //!< FREE_, BUSY_, or VALID_
+    };
+
+    //! states of the cache entries
+    enum : std::uint8_t { FREE_, BUSY_, VALID_ };
+
+    //! index of the first entry to probe for the given transition
+    static std::uint_fast8_t hash_(QStateHandler const leaf,
+                                   QStateHandler const src,
+                                   QStateHandler const tgt) noexcept;
+
+    Entry m_entry[QHSM_TRAN_CACHE]; //!< open-addressing hash table
+
+    friend class QHsm;
+};
+#endif // QHSM_TRAN_CACHE
+
+#ifdef QHSM_STATE_TABLE
+//============================================================================
+//! Table of the state parents of a QP::QHsm subclass
+//! @description
+//! A QP::QHsm state machine discovers the superstate of a state by calling
+//! the state handler with the empty signal. QHsmStateTable remembers the
+//! superstates, so that the discovery of transition paths, the superstate
+//! of a state that left an event unhandled due to a guard,
+//! QP::QHsm::isIn(), and QP::QHsm::childState() are table lookups instead
+//! of state-handler calls. The table is built while the state machine is
+//! initialized and running, or it can be filled in advance with
+//! QP::QHsmStateTable::add(). The table is typically a static object shared
+//! by all instances of a QP::QHsm subclass and attached to them with
+//! QP::QHsm::setStateTable(). When the table is full, the superstates of
+//! the remaining states are found the regular way.
+//!
+//! @note
+//! The table can be shared by state machines running in different threads,
+//! because the entries are claimed and published atomically (with the GCC
+//! atomic builtins).
+//!
+class QHsmStateTable {
+public:
+    //! the default constructor (empty table)
+    QHsmStateTable() noexcept;
+
+    //! add the superstate @p super of the state @p s to the table
+    bool add(QStateHandler const s, QStateHandler const super) noexcept;
+
+private:
+    //! parent of a state
+    struct Entry {
+        QStateHandler fun;   //!< the state
+        QStateHandler super; //!< superstate of the state (NULL for top)
+        std::uint8_t state;  //!< FREE_, BUSY_, or VALID_
+    };
+
+    //! states of the table entries
+    enum : std::uint8_t { FREE_, BUSY_, VALID_ };
+
+    //! claim the free entry @p i and publish the parent of @p s in it
+    bool add_(std::uint_fast8_t const i, QStateHandler const s,
+              QStateHandler const super) noexcept;
+
+    //! index of the first entry to probe for the given state
+    static std::uint_fast8_t hash_(QStateHandler const s) noexcept;
+
+    Entry m_entry[QHSM_STATE_TABLE]; //!< open-addressing hash table
+
+    friend class QHsm;
+};
+#endif // QHSM_STATE_TABLE
+
 //============================================================================
 //! QM State Machine implementation strategy
 //! @description
@@ -684,4 +861,483 @@ constexpr enum_t Q_USER_SIG {4};
 //! Applicable to suclasses of QP::QMsm.
 #define QM_STATE_NULL         (nullptr)
 
+#ifdef QHSM_CONSTEXPR // state machines flattened at compile time?
+//============================================================================
+namespace QP {
+
+//! Pointer to an action of the QP::QConstexprSm state machine
+//! (entry, exit, initial transition, or transition action)
+using QCsmAction = void (*)(void * const me, QEvt const * const e);
+
+//! Pointer to a guard condition of the QP::QConstexprSm state machine
+using QCsmGuard = bool (*)(void * const me, QEvt const * const e);
+
+//! State of the QP::QConstexprSm state machine
+//! @description
+//! The states of a QP::QConstexprSm are identified by their indices in the
+//! array of states of the specification (see QP::QConstexprSm).
+struct QCsmState {
+    std::uint8_t parent;  //!< index of the superstate (QCsm::TOP for top)
+    std::uint8_t init;    //!< target of the initial tran. (QCsm::NONE)
+    QCsmAction   entry;   //!< entry action (might be NULL)
+    QCsmAction   exit;    //!< exit action (might be NULL)
+    QCsmAction   initAct; //!< action of the initial transition (or NULL)
+};
+
+//! Transition of the QP::QConstexprSm state machine
+struct QCsmTran {
+    std::uint8_t source;  //!< index of the source state
+    QSignal      sig;     //!< signal triggering the transition
+    std::uint8_t target;  //!< index of the target (QCsm::NONE: internal)
+    QCsmGuard    guard;   //!< guard condition (might be NULL)
+    QCsmAction   action;  //!< transition action (might be NULL)
+};
+
+//! Flattened tables of the QP::QConstexprSm state machine
+//! @description
+//! The tables are computed at compile time by QP::QCsmFlat from the
+//! specification of the state machine. The transitions are indexed from 0
+//! to @c nTran-1, and the index @c nTran denotes the top-most initial
+//! transition.
+struct QCsmTables {
+    QCsmState const *state;   //!< states [nState]
+    QCsmTran const  *tran;    //!< transitions [nTran]
+    QCsmTran const  *init;    //!< top-most initial transition
+    std::uint8_t const *depth; //!< nesting depth of states [nState]
+    std::uint8_t const *cell;  //!< innermost tran. [nState*nSig]
+    std::uint8_t const *next;  //!< next candidate tran. [nTran]
+    std::uint8_t const *lca;   //!< LCA of transitions [nTran+1]
+    std::uint8_t const *leaf;  //!< leaf state after tran. [nTran+1]
+    std::uint8_t const *path;  //!< entry paths [(nTran+1)*maxDepth]
+    QSignal      nSig;     //!< number of signals in the cell table
+    std::uint8_t nState;   //!< number of states
+    std::uint8_t nTran;    //!< number of transitions
+    std::uint8_t maxDepth; //!< maximum nesting depth of states
+};
+
+//============================================================================
+//! Event processor of the QP::QConstexprSm state machines
+//! @description
+//! QCsm executes the flattened tables of a state machine: the dispatching
+//! of an event is a table lookup of the innermost transition enabled in
+//! the current state, followed by the precomputed exit and entry actions.
+//! No state is called to find its superstate.
+class QCsm {
+public:
+    //! special indices of states and transitions
+    enum : std::uint8_t {
+        TOP  = 0xFFU, //!< the top state (superstate of the top-level states)
+        NONE = 0xFEU  //!< no state (internal transition, leaf state)
+    };
+
+    //! executes the top-most initial transition
+    static void init(QHsm * const me, std::uint8_t &state,
+                     QCsmTables const &tbl, void const * const e,
+                     std::uint_fast8_t const qs_id);
+
+    //! dispatches an event to the state machine in the @p state
+    static void dispatch(QHsm * const me, std::uint8_t &state,
+                         QCsmTables const &tbl, QEvt const * const e,
+                         std::uint_fast8_t const qs_id);
+
+    //! tests if the @p state is the state @p s or is nested in it
+    static bool isIn(QCsmTables const &tbl, std::uint8_t const state,
+                     std::uint8_t const s) noexcept;
+
+private:
+    //! enters the entry path of the transition @p k
+    static void enter_(QHsm * const me, QCsmTables const &tbl,
+                       std::uint_fast8_t const k, QEvt const * const e,
+                       std::uint_fast8_t const qs_id);
+
+    //! executes the initial transition of the state @p s
+    static std::uint8_t init_(QHsm * const me, QCsmTables const &tbl,
+                              std::uint8_t const s, QEvt const * const e,
+                              std::uint_fast8_t const qs_id);
+};
+
+//! sequence of indices for generating the QP::QCsmFlat tables
+template<std::uint_fast16_t... I_>
+struct QCsmSeq {
+};
+
+//! concatenation of two sequences of indices
+template<typename A_, typename B_>
+struct QCsmCat;
+
+template<std::uint_fast16_t... I_, std::uint_fast16_t... J_>
+struct QCsmCat<QCsmSeq<I_...>, QCsmSeq<J_...>> {
+    using type = QCsmSeq<I_..., (sizeof...(I_) + J_)...>;
+};
+
+//! sequence of indices 0..N_-1 (generated with logarithmic depth)
+template<std::uint_fast16_t N_>
+struct QCsmMakeSeq {
+    using type = typename QCsmCat<typename QCsmMakeSeq<N_/2U>::type,
+                     typename QCsmMakeSeq<N_ - N_/2U>::type>::type;
+};
+
+template<>
+struct QCsmMakeSeq<0U> {
+    using type = QCsmSeq<>;
+};
+
+template<>
+struct QCsmMakeSeq<1U> {
+    using type = QCsmSeq<0U>;
+};
+
+//! constant table of bytes generated at compile time as Gen_::at(i)
+template<typename Gen_, typename Seq_>
+struct QCsmTable;
+
+template<typename Gen_, std::uint_fast16_t... I_>
+struct QCsmTable<Gen_, QCsmSeq<I_...>> {
+    static constexpr std::uint8_t tbl[sizeof...(I_)] { Gen_::at(I_)... };
+};
+
+template<typename Gen_, std::uint_fast16_t... I_>
+constexpr std::uint8_t QCsmTable<Gen_, QCsmSeq<I_...>>::tbl[sizeof...(I_)];
+
+//============================================================================
+//! Compile-time flattening of the QP::QConstexprSm specification
+//! @description
+//! All functions of this class are evaluated at compile time to generate
+//! the tables of QP::QCsmTables (see QP::QConstexprSm for the
+//! specification @p Spec_).
+template<typename Spec_>
+class QCsmFlat {
+public:
+    //! number of states
+    static constexpr std::uint8_t N_STATE {
+        static_cast<std::uint8_t>(sizeof(Spec_::state)
+                                  / sizeof(Spec_::state[0]))};
+
+    //! number of transitions
+    static constexpr std::uint8_t N_TRAN {
+        static_cast<std::uint8_t>(sizeof(Spec_::tran)
+                                  / sizeof(Spec_::tran[0]))};
+
+    //! the transition @p k (N_TRAN: the top-most initial transition)
+    static constexpr QCsmTran tranAt(std::uint_fast16_t const k) {
+        return (k < N_TRAN) ? Spec_::tran[k] : Spec_::init;
+    }
+
+    //! number of signals (the highest signal of a transition plus one)
+    static constexpr QSignal nSig(std::uint_fast16_t const k) {
+        return (k >= N_TRAN) ? static_cast<QSignal>(0U)
+               : max_(static_cast<QSignal>(Spec_::tran[k].sig + 1U),
+                      nSig(k + 1U));
+    }
+
+    //! superstate of the state @p s
+    static constexpr std::uint8_t parent(std::uint8_t const s) {
+        return Spec_::state[s].parent;
+    }
+
+    //! nesting depth of the state @p s (0 for top, 1 for top-level states)
+    static constexpr std::uint8_t depth(std::uint8_t const s) {
+        return (s == QCsm::TOP) ? static_cast<std::uint8_t>(0U)
+               : static_cast<std::uint8_t>(depth(parent(s)) + 1U);
+    }
+
+    //! maximum nesting depth of the states @p s..N_STATE-1
+    static constexpr std::uint8_t maxDepth(std::uint8_t const s) {
+        return (s >= N_STATE) ? static_cast<std::uint8_t>(0U)
+               : max_(depth(s),
+                      maxDepth(static_cast<std::uint8_t>(s + 1U)));
+    }
+
+    //! ancestor of the state @p s at the depth @p d
+    static constexpr std::uint8_t ancestor(std::uint8_t const s,
+                                           std::uint_fast16_t const d)
+    {
+        return (depth(s) <= d) ? s : ancestor(parent(s), d);
+    }
+
+    //! common ancestor of the states @p a and @p b
+    static constexpr std::uint8_t common(std::uint8_t const a,
+                                         std::uint8_t const b)
+    {
+        return (a == b) ? a
+               : (depth(a) > depth(b)) ? common(parent(a), b)
+               : (depth(b) > depth(a)) ? common(a, parent(b))
+               : common(parent(a), parent(b));
+    }
+
+    //! leaf state reached by the initial transitions of the state @p s
+    static constexpr std::uint8_t leafOf(std::uint8_t const s) {
+        return (Spec_::state[s].init == QCsm::NONE) ? s
+               : leafOf(Spec_::state[s].init);
+    }
+
+    //! least common ancestor (LCA) of the transition @p k, as in QP::QHsm:
+    //! the parent of the source for a transition to self, the source for
+    //! a transition to a substate, and the target for a transition to
+    //! a superstate (the LCA is neither exited nor entered)
+    static constexpr std::uint8_t lca(std::uint_fast16_t const k) {
+        return (tranAt(k).target == QCsm::NONE) ? none_()
+               : (tranAt(k).source == tranAt(k).target)
+                   ? parent(tranAt(k).target)
+               : common(tranAt(k).source, tranAt(k).target);
+    }
+
+    //! leaf state after the transition @p k
+    static constexpr std::uint8_t leaf(std::uint_fast16_t const k) {
+        return (tranAt(k).target == QCsm::NONE) ? none_()
+               : leafOf(tranAt(k).target);
+    }
+
+    //! state @p j on the entry path of the transition @p k (from the LCA
+    //! down to the leaf)
+    static constexpr std::uint8_t path(std::uint_fast16_t const k,
+                                       std::uint_fast16_t const j)
+    {
+        return ((tranAt(k).target == QCsm::NONE)
+                || ((depth(lca(k)) + 1U + j) > depth(leaf(k))))
+               ? none_()
+               : ancestor(leaf(k), depth(lca(k)) + 1U + j);
+    }
+
+    //! first transition from the index @p k defined in the state @p s
+    //! for the signal @p sig
+    static constexpr std::uint8_t local(std::uint8_t const s,
+                                        QSignal const sig,
+                                        std::uint_fast16_t const k)
+    {
+        return (k >= N_TRAN) ? none_()
+               : ((Spec_::tran[k].source == s)
+                  && (Spec_::tran[k].sig == sig))
+                   ? static_cast<std::uint8_t>(k)
+               : local(s, sig, k + 1U);
+    }
+
+    //! innermost transition for the signal @p sig in the state @p s
+    //! or its superstates
+    static constexpr std::uint8_t find(std::uint8_t const s,
+                                       QSignal const sig)
+    {
+        return (s == QCsm::TOP) ? none_()
+               : orUp(local(s, sig, 0U), s, sig);
+    }
+
+    //! the transition @p k if found, or the transition found in the
+    //! superstate of @p s otherwise
+    static constexpr std::uint8_t orUp(std::uint8_t const k,
+                                       std::uint8_t const s,
+                                       QSignal const sig)
+    {
+        return (k != QCsm::NONE) ? k : find(parent(s), sig);
+    }
+
+    //! next candidate after the transition @p k when its guard is false
+    static constexpr std::uint8_t next(std::uint_fast16_t const k) {
+        return (k >= N_TRAN) ? none_()
+               : orUp(local(Spec_::tran[k].source, Spec_::tran[k].sig,
+                            k + 1U),
+                      Spec_::tran[k].source, Spec_::tran[k].sig);
+    }
+
+    //! the state @p s is valid and properly nested
+    static constexpr bool isValid(std::uint8_t const s) {
+        return (s >= N_STATE) ? true
+               : ((Spec_::state[s].parent == QCsm::TOP)
+                  || (Spec_::state[s].parent < s))
+                 && ((Spec_::state[s].init == QCsm::NONE)
+                     || ((Spec_::state[s].init < N_STATE)
+                         && (Spec_::state[s].init != s)
+                         && isNested(Spec_::state[s].init, s)))
+                 && isValid(static_cast<std::uint8_t>(s + 1U));
+    }
+
+    //! the state @p s is nested in the state @p a (or is @p a)
+    static constexpr bool isNested(std::uint8_t const s,
+                                   std::uint8_t const a)
+    {
+        return (s == a) ? true
+               : (s == QCsm::TOP) ? false
+               : isNested(parent(s), a);
+    }
+
+    //! the transitions @p k..N_TRAN are valid
+    static constexpr bool isValidTran(std::uint_fast16_t const k) {
+        return (k > N_TRAN) ? true
+               : ((k == N_TRAN) ? (tranAt(k).source == QCsm::TOP)
+                                  && (tranAt(k).target < N_STATE)
+                                : (tranAt(k).source < N_STATE)
+                                  && ((tranAt(k).target < N_STATE)
+                                      || (tranAt(k).target == QCsm::NONE)))
+                 && isValidTran(k + 1U);
+    }
+
+    //! generator of the table of depths
+    struct Depth {
+        static constexpr std::uint8_t at(std::uint_fast16_t const i) {
+            return depth(static_cast<std::uint8_t>(i));
+        }
+    };
+
+    //! generator of the table of innermost transitions
+    struct Cell {
+        static constexpr std::uint8_t at(std::uint_fast16_t const i) {
+            return find(static_cast<std::uint8_t>(i / nSig(0U)),
+                        static_cast<QSignal>(i % nSig(0U)));
+        }
+    };
+
+    //! generator of the table of next candidate transitions
+    struct Next {
+        static constexpr std::uint8_t at(std::uint_fast16_t const i) {
+            return next(i);
+        }
+    };
+
+    //! generator of the table of LCAs
+    struct Lca {
+        static constexpr std::uint8_t at(std::uint_fast16_t const i) {
+            return lca(i);
+        }
+    };
+
+    //! generator of the table of leaf states
+    struct Leaf {
+        static constexpr std::uint8_t at(std::uint_fast16_t const i) {
+            return leaf(i);
+        }
+    };
+
+    //! generator of the table of entry paths
+    struct Path {
+        static constexpr std::uint8_t at(std::uint_fast16_t const i) {
+            return path(i / maxDepth(0U), i % maxDepth(0U));
+        }
+    };
+
+    static_assert(N_STATE < QCsm::NONE, "too many states");
+    static_assert(N_TRAN < QCsm::NONE, "too many transitions");
+    static_assert(isValid(0U), "superstate or initial transition invalid");
+    static_assert(isValidTran(0U), "transition invalid");
+
+    //! the flattened tables
+    static constexpr QCsmTables tables {
+        &Spec_::state[0],
+        &Spec_::tran[0],
+        &Spec_::init,
+        QCsmTable<Depth, typename QCsmMakeSeq<N_STATE>::type>::tbl,
+        QCsmTable<Cell, typename QCsmMakeSeq<
+            N_STATE * nSig(0U)>::type>::tbl,
+        QCsmTable<Next, typename QCsmMakeSeq<N_TRAN + 1U>::type>::tbl,
+        QCsmTable<Lca,  typename QCsmMakeSeq<N_TRAN + 1U>::type>::tbl,
+        QCsmTable<Leaf, typename QCsmMakeSeq<N_TRAN + 1U>::type>::tbl,
+        QCsmTable<Path, typename QCsmMakeSeq<
+            (N_TRAN + 1U) * maxDepth(0U)>::type>::tbl,
+        nSig(0U),
+        N_STATE,
+        N_TRAN,
+        maxDepth(0U)
+    };
+
+private:
+    //! no state or transition (QCsm::NONE)
+    static constexpr std::uint8_t none_() {
+        return static_cast<std::uint8_t>(QCsm::NONE);
+    }
+
+    //! the greater of @p a and @p b
+    template<typename T_>
+    static constexpr T_ max_(T_ const a, T_ const b) {
+        return (a > b) ? a : b;
+    }
+};
+
+template<typename Spec_>
+constexpr std::uint8_t QCsmFlat<Spec_>::N_STATE;
+
+template<typename Spec_>
+constexpr std::uint8_t QCsmFlat<Spec_>::N_TRAN;
+
+template<typename Spec_>
+constexpr QCsmTables QCsmFlat<Spec_>::tables;
+
+//============================================================================
+//! State machine flattened at compile time
+//! @description
+//! QConstexprSm implements a hierarchical state machine specified by
+//! constant tables of states and transitions instead of state-handler
+//! functions. The hierarchy is flattened at compile time (see
+//! QP::QCsmFlat) into a table of the innermost transition enabled in every
+//! state for every signal, and into the precomputed least common ancestors
+//! and entry paths of all transitions. Dispatching an event is then a table
+//! lookup followed by the exit and entry actions, without calling any
+//! state to find its superstate. The semantics of the transitions (and the
+//! QS_QEP_* trace records) are the same as in QP::QHsm.
+//!
+//! The specification @p Spec_ must provide the following static constexpr
+//! members (which need definitions at the namespace scope in C++11):
+//! - @c state[] -- the array of QP::QCsmState, where every superstate
+//!   precedes its substates
+//! - @c tran[] -- the array of QP::QCsmTran, where the transitions of the
+//!   same source and signal are evaluated in the order of the array
+//! - @c init -- the top-most initial transition (source QCsm::TOP)
+//!
+//! @note
+//! The QS trace records identify the states by the addresses of their
+//! QP::QCsmState objects, which can be given names with QS_FUN_DICTIONARY().
+//!
+//! @note
+//! QP::QConstexprSm and QP::QConstexprActive are available only when the
+//! macro QHSM_CONSTEXPR is defined (in qep_port.hpp or on the command line).
+//!
+template<typename Spec_>
+class QConstexprSm : public QHsm {
+public:
+    //! executes the top-most initial transition
+    void init(void const * const e,
+              std::uint_fast8_t const qs_id) override
+    {
+        QCsm::init(this, m_csmState, QCsmFlat<Spec_>::tables, e, qs_id);
+    }
+
+    //! overloaded init(qs_id)
+    void init(std::uint_fast8_t const qs_id) override {
+        init(nullptr, qs_id);
+    }
+
+    //! dispatches an event to the state machine
+    void dispatch(QEvt const * const e,
+                  std::uint_fast8_t const qs_id) override
+    {
+        QCsm::dispatch(this, m_csmState, QCsmFlat<Spec_>::tables, e,
+                       qs_id);
+    }
+
+    //! Tests if the state @p s is part of the active state configuration
+    bool isInState(std::uint8_t const s) const noexcept {
+        return QCsm::isIn(QCsmFlat<Spec_>::tables, m_csmState, s);
+    }
+
+    //! Obtain the current (leaf) state
+    std::uint8_t stateIdx(void) const noexcept {
+        return m_csmState;
+    }
+
+protected:
+    //! protected constructor (abstract class)
+    QConstexprSm() noexcept
+      : QHsm(Q_STATE_CAST(&QHsm::top)),
+        m_csmState(QCsm::TOP)
+    {}
+
+private:
+    std::uint8_t m_csmState; //!< current (leaf) state
+
+    //! operations inherited from QP::QHsm, but disallowed
+    using QHsm::isIn;
+    using QHsm::state;
+    using QHsm::childState;
+};
+
+} // namespace QP
+#endif // QHSM_CONSTEXPR
+
 #endif // QEP_HPP
@@ -53,6 +53,62 @@
     #define QF_MAX_EPOOL         3U
 #endif
 
+#ifndef QF_EPOOL_LUT_SIZE
+    //! Default value of the macro configurable value in qf_port.hpp.
+    //! The number of entries in the lookup table mapping event sizes to
+    //! event pools, one entry per pointer-size of the event (see QF::newX_).
+    //! Valid values: [1U..65535U]; default 32U
+    #define QF_EPOOL_LUT_SIZE    32U
+#elif (QF_EPOOL_LUT_SIZE < 1U)
+    #error "QF_EPOOL_LUT_SIZE must be at least 1U"
+#endif
+
+#ifdef QF_MAX_BUFPOOL
+    //! The macro QF_MAX_BUFPOOL (if defined in qf_port.hpp or on the
+    //! command line) enables the zero-copy buffer events (QP::QBufEvt) and
+    //! sets the maximum number of the payload-buffer pools.
+    //! Valid values: [1U..255U]
+    #if (QF_MAX_BUFPOOL < 1U) || (QF_MAX_BUFPOOL > 255U)
+        #error "QF_MAX_BUFPOOL must be in the range 1U..255U"
+    #endif
+#endif
+
+#ifdef QF_ACTIVE_BATCH
+    //! The macro QF_ACTIVE_BATCH (if defined in qf_port.hpp or on the
+    //! command line) sets the default batch budget of active objects, which
+    //! is the maximum number of queued events the QV and QK kernels (and the
+    //! POSIX-QV port) dispatch to the same AO in one activation before
+    //! re-evaluating the priorities (see QP::QActive::setBatch()).
+    //! Valid values: [1U..255U]
+    #if (QF_ACTIVE_BATCH < 1U) || (QF_ACTIVE_BATCH > 255U)
+        #error "QF_ACTIVE_BATCH must be in the range 1U..255U"
+    #endif
+#endif
+
+#ifdef QF_ACTIVE_CONFLATE
+    //! The macro QF_ACTIVE_CONFLATE (if defined in qf_port.hpp or on the
+    //! command line) enables the conflating ("latest-value") event queues
+    //! of active objects (see QP::QActive::setConflate()) for the signals
+    //! below QF_ACTIVE_CONFLATE. Available only with the native QF event
+    //! queue (QP::QEQueue). Valid values: [1U..65535U]
+    #if (QF_ACTIVE_CONFLATE < 1U) || (QF_ACTIVE_CONFLATE > 65535U)
+        #error "QF_ACTIVE_CONFLATE must be in the range 1U..65535U"
+    #endif
+#endif
+
+#ifdef QF_PS_SPARSE
+    //! The macro QF_PS_SPARSE (if defined in qf_port.hpp or on the command
+    //! line) replaces the signal-indexed array of subscriber lists with a
+    //! compact hash table of QF_PS_SPARSE entries inside QF, which holds
+    //! only the signals with at least one subscriber (see QP::QF::psInit()).
+    //! The table must have room for all simultaneously subscribed signals
+    //! plus one. Valid values: powers of 2 in the range [2U..4096U]
+    #if (QF_PS_SPARSE < 2U) || (QF_PS_SPARSE > 4096U) \
+        || ((QF_PS_SPARSE & (QF_PS_SPARSE - 1U)) != 0U)
+        #error "QF_PS_SPARSE must be a power of 2 in the range 2U..4096U"
+    #endif
+#endif
+
 #ifndef QF_MAX_TICK_RATE
     //! Default value of the macro configurable value in qf_port.hpp
     //! Valid values: [0U..15U]; default 1U
@@ -67,6 +123,18 @@
     #define QF_TIMEEVT_CTR_SIZE  2U
 #endif
 
+#ifdef QF_TIMEEVT_WHEEL
+    //! The macro QF_TIMEEVT_WHEEL (if defined in qf_port.hpp or on the
+    //! command line) selects the timing-wheel implementation of time events
+    //! with the given number of slots per tick rate. Valid values: powers
+    //! of 2 not exceeding the dynamic range of QTimeEvtCtr. If not defined,
+    //! the armed time events are kept in a simple linked list.
+    #if (QF_TIMEEVT_WHEEL < 2U) \
+        || ((QF_TIMEEVT_WHEEL & (QF_TIMEEVT_WHEEL - 1U)) != 0U)
+        #error "QF_TIMEEVT_WHEEL must be a power of 2"
+    #endif
+#endif
+
 
 //============================================================================
 namespace QP {
@@ -107,6 +175,14 @@ namespace QP {
 
 class QEQueue; // forward declaration
 
+#ifdef QF_PS_FILTER
+//! Pointer to a subscription-filter function
+//! @description
+//! The filter of the active object @p me decides whether the published
+//! event @p e is posted to the AO (see QP::QActive::setPublishFilter()).
+using QSubscrFilter = bool (*)(void const * const me, QEvt const * const e);
+#endif // QF_PS_FILTER
+
 //============================================================================
 //! QActive active object (based on QP::QHsm implementation)
 //! @description
@@ -176,6 +252,16 @@ public: // for access from extern "C" functions
     //! QF priority (1..#QF_MAX_ACTIVE) of this active object.
     std::uint8_t m_prio;
 
+#ifdef QF_ACTIVE_BATCH
+    //! maximum number of events dispatched in one activation of this AO
+    std::uint8_t m_batch;
+#endif
+
+#ifdef QF_ACTIVE_CONFLATE
+    //! bitmask of the signals conflated in the event queue of this AO
+    std::uint8_t m_conflate[(QF_ACTIVE_CONFLATE + 7U) / 8U];
+#endif
+
 protected:
     //! protected constructor (abstract class)
     QActive(QStateHandler const initial) noexcept;
@@ -230,6 +316,11 @@ public:
     //! Un-subscribes from the delivery of signal @p sig to the active object.
     void unsubscribe(enum_t const sig) const noexcept;
 
+#ifdef QF_PS_FILTER
+    //! Sets the @p filter of all events published to the active object
+    void setPublishFilter(QSubscrFilter const filter) noexcept;
+#endif
+
     //! Defer an event to a given separate event queue.
     bool defer(QEQueue * const eq, QEvt const * const e) const noexcept;
 
@@ -249,6 +340,27 @@ public:
         m_prio = static_cast<std::uint8_t>(prio);
     }
 
+#ifdef QF_ACTIVE_BATCH
+    //! Set the batch budget of the active object.
+    //! @description
+    //! The batch budget is the maximum number of queued events that the
+    //! scheduler dispatches to this AO in one activation (default
+    //! #QF_ACTIVE_BATCH). A larger budget amortizes the scheduling overhead
+    //! for high-rate events that need little work each, but in the
+    //! non-preemptive QV kernel it also adds up to (@p batch - 1) RTC steps
+    //! of this AO to the latency of higher-priority AOs. Both 0 and 1 mean
+    //! one event per activation.
+    void setBatch(std::uint_fast8_t const batch) noexcept {
+        m_batch = static_cast<std::uint8_t>(batch);
+    }
+#endif
+
+#ifdef QF_ACTIVE_CONFLATE
+    //! Enable or disable conflating the signal @p sig in the event queue
+    //! of the active object.
+    void setConflate(enum_t const sig, bool const conflate) noexcept;
+#endif
+
     //! Generic setting of additional attributes (useful in QP ports)
     void setAttr(std::uint32_t attr1, void const *attr2 = nullptr);
 
@@ -267,6 +379,29 @@ public:
     //! Get an event from the event queue of an active object.
     QEvt const *get_(void) noexcept;
 
+#ifdef QF_ACTIVE_CONFLATE
+private:
+    //! find the queue entry holding a pending event with the conflated
+    //! signal @p sig (nullptr if the signal is not conflated or not pending)
+    QEvt const * volatile *conflateEntry_(QSignal const sig) noexcept;
+
+public:
+#endif
+
+#ifdef QF_PS_FILTER
+private:
+    //! filter of the events published to this AO (nullptr for none)
+    QSubscrFilter volatile m_psFilter;
+
+    //! does the publish filter of this AO accept the event @p e?
+    bool psAccepts_(QEvt const * const e) const noexcept {
+        QSubscrFilter const filter = m_psFilter; // read the volatile once
+        return (filter == nullptr) || (*filter)(this, e);
+    }
+
+public:
+#endif
+
 // duplicated API to be used exclusively inside ISRs (useful in some QP ports)
 #ifdef QF_ISR_API
 #ifdef Q_SPY
@@ -355,6 +490,66 @@ private:
     using QHsm::childState;
 };
 
+#ifdef QHSM_CONSTEXPR
+//============================================================================
+//! QConstexprActive active object (based on QP::QConstexprSm)
+//! @description
+//! QP::QConstexprActive represents an active object with a state machine
+//! flattened at compile time from the specification @p Spec_ (see
+//! QP::QConstexprSm), which dispatches events in constant time.
+//!
+//! @note
+//! QP::QConstexprActive is not intended to be instantiated directly, but
+//! rather serves as the base class for derivation of active objects in the
+//! applications.
+//!
+template<typename Spec_>
+class QConstexprActive : public QActive {
+public:
+    // all the following operations delegate to the QCsm event processor...
+    void init(void const * const e,
+              std::uint_fast8_t const qs_id) override
+    {
+        QCsm::init(this, m_csmState, QCsmFlat<Spec_>::tables, e, qs_id);
+    }
+    void init(std::uint_fast8_t const qs_id) override {
+        init(nullptr, qs_id);
+    }
+    void dispatch(QEvt const * const e,
+                  std::uint_fast8_t const qs_id) override
+    {
+        QCsm::dispatch(this, m_csmState, QCsmFlat<Spec_>::tables, e,
+                       qs_id);
+    }
+
+    //! Tests if the state @p s is part of the active state configuration
+    bool isInState(std::uint8_t const s) const noexcept {
+        return QCsm::isIn(QCsmFlat<Spec_>::tables, m_csmState, s);
+    }
+
+    //! Obtain the current (leaf) state
+    std::uint8_t stateIdx(void) const noexcept {
+        return m_csmState;
+    }
+
+protected:
+    //! protected constructor (abstract class)
+    QConstexprActive() noexcept
+      : QActive(Q_STATE_CAST(&QHsm::top)),
+        m_csmState(QCsm::TOP)
+    {}
+
+private:
+    std::uint8_t m_csmState; //!< current (leaf) state
+
+    //! operations inherited from QP::QHsm, but disallowed
+    using QHsm::isIn;
+    using QHsm::state;
+    using QHsm::childState;
+};
+
+#endif // QHSM_CONSTEXPR
+
 //============================================================================
 //! Time Event class
 //! @description
@@ -379,7 +574,12 @@ private:
 //! Internally, the armed time events are organized into a bi-directional
 //! linked list. This linked list is scanned in every invocation of the
 //! QP::QF::tickX_() function. Only armed (timing out) time events are in the
-//! list, so only armed time events consume CPU cycles.
+//! list, so only armed time events consume CPU cycles.@n
+//! @n
+//! Alternatively, when the macro #QF_TIMEEVT_WHEEL is defined, the armed
+//! time events are hashed by their expiration tick into a timing wheel of
+//! #QF_TIMEEVT_WHEEL slots and QP::QF::tickX_() visits only the one slot
+//! corresponding to the current tick.
 //!
 //! @note
 //! QF manages the time events in the macro TICK_X(), which must be called
@@ -419,6 +619,12 @@ private:
     //! keeps timing out periodically.
     QTimeEvtCtr m_interval;
 
+#ifdef QF_TIMEEVT_WHEEL
+    //! link to the m_next attribute of the previous time event in the
+    //! timing-wheel slot (or to the slot itself) for O(1) unlinking
+    QTimeEvt * volatile *m_prevNext;
+#endif
+
 public:
 
     //! The Time Event constructor.
@@ -461,6 +667,26 @@ private:
         return static_cast<QTimeEvt *>(m_act);
     }
 
+#ifdef QF_TIMEEVT_WHEEL
+    //! insert this time event at the front of the list at @p link
+    void wheelLink_(QTimeEvt * volatile * const link) noexcept {
+        m_next = *link;
+        if (m_next != nullptr) {
+            m_next->m_prevNext = &m_next;
+        }
+        *link = this;
+        m_prevNext = link;
+    }
+
+    //! remove this time event from the list it is linked into
+    void wheelUnlink_(void) noexcept {
+        *m_prevNext = m_next;
+        if (m_next != nullptr) {
+            m_next->m_prevNext = m_prevNext;
+        }
+    }
+#endif // QF_TIMEEVT_WHEEL
+
     friend class QF;
     friend class QS;
 #ifdef QXK_HPP
@@ -479,6 +705,66 @@ private:
 using QSubscrList = QPSet;
 
 
+#ifdef QF_MAX_BUFPOOL
+//============================================================================
+//! Reference-counted payload buffer for the zero-copy buffer events
+//! @description
+//! QP::QBuf is the header of a payload "slab" allocated from one of the
+//! payload-buffer pools (see QP::QF::bufPoolInit()). The payload follows
+//! the header. The buffer is referenced by one or more buffer events
+//! (QP::QBufEvt) and is recycled automatically together with the last
+//! buffer event referencing it, so a large payload can be posted,
+//! published, or deferred without copying.
+//!
+//! @sa Q_NEW_BUF(), Q_NEW_BUF_EVT()
+class QBuf {
+public:
+    //! pointer to the payload data
+    std::uint8_t *data(void) noexcept {
+        return &reinterpret_cast<std::uint8_t *>(this)[hdrSize()];
+    }
+
+    //! pointer to the payload data (const version)
+    std::uint8_t const *data(void) const noexcept {
+        return &reinterpret_cast<std::uint8_t const *>(this)[hdrSize()];
+    }
+
+    //! the size of the payload data (in bytes) requested in Q_NEW_BUF()
+    std::uint_fast32_t size(void) const noexcept {
+        return m_size;
+    }
+
+    //! the size of the header before the payload data, which keeps the
+    //! payload aligned for storing pointers
+    static constexpr std::uint_fast16_t hdrSize(void) noexcept {
+        return static_cast<std::uint_fast16_t>(
+            ((sizeof(QBuf) + sizeof(void *) - 1U) / sizeof(void *))
+            * sizeof(void *));
+    }
+
+private:
+    std::uint32_t m_size;           //!< size of the payload data
+    std::uint8_t m_poolId;          //!< ID of the payload-buffer pool
+    std::uint8_t volatile m_refCtr; //!< # buffer events referencing it
+
+    friend class QF;
+};
+
+//============================================================================
+//! Buffer event referencing a zero-copy payload buffer
+//! @description
+//! QP::QBufEvt is a small event allocated from the dedicated pool of buffer
+//! events (see QP::QF::bufEvtPoolInit()), which holds a reference to the
+//! payload buffer QP::QBuf. Buffer events are handled by QF as any other
+//! dynamic events (posting, publishing, deferring), and when the last
+//! reference to a buffer event is garbage-collected, QF releases also
+//! its reference to the payload buffer.
+class QBufEvt : public QEvt {
+public:
+    QBuf *buf; //!< the referenced payload buffer
+};
+#endif // QF_MAX_BUFPOOL
+
 //============================================================================
 //! QF services.
 //! @description
@@ -507,6 +793,29 @@ public:
     //! Obtain the block size of any registered event pools
     static std::uint_fast16_t poolGetMaxBlockSize(void) noexcept;
 
+#ifdef QF_MAX_BUFPOOL
+    //! Initialization of the pool of buffer events (QP::QBufEvt).
+    static void bufEvtPoolInit(void * const poolSto,
+                               std::uint_fast32_t const poolSize) noexcept;
+
+    //! Initialization of a pool of payload buffers (QP::QBuf).
+    static void bufPoolInit(void * const poolSto,
+                            std::uint_fast32_t const poolSize,
+                            std::uint_fast32_t const bufSize) noexcept;
+
+    //! Internal QF implementation of creating a new payload buffer.
+    static QBuf *newBuf_(std::uint_fast32_t const size,
+                         std::uint_fast16_t const margin) noexcept;
+
+    //! Internal QF implementation of creating a new buffer event.
+    static QBufEvt *newBufEvt_(QBuf * const buf,
+                               std::uint_fast16_t const margin,
+                               enum_t const sig) noexcept;
+
+    //! Recycle a payload buffer (not referenced by any buffer event).
+    static void bufGc(QBuf * const buf) noexcept;
+#endif // QF_MAX_BUFPOOL
+
 
     //! Transfers control to QF to run the application.
     static int_t run(void);
@@ -524,6 +833,8 @@ public:
 #ifndef Q_SPY
     static void publish_(QEvt const * const e) noexcept;
     static void tickX_(std::uint_fast8_t const tickRate) noexcept;
+    static void tickNX_(std::uint_fast8_t const tickRate,
+                        QTimeEvtCtr const nTicks) noexcept;
 #else
     //! Publish event to the framework.
     static void publish_(QEvt const * const e,
@@ -533,12 +844,21 @@ public:
     //! Processes all armed time events at every clock tick.
     static void tickX_(std::uint_fast8_t const tickRate,
                        void const * const sender) noexcept;
+
+    //! Processes all armed time events for several clock ticks at once.
+    static void tickNX_(std::uint_fast8_t const tickRate,
+                        QTimeEvtCtr const nTicks,
+                        void const * const sender) noexcept;
 #endif // Q_SPY
 
     //! Returns true if all time events are inactive and false
     //! any time event is active.
     static bool noTimeEvtsActiveX(std::uint_fast8_t const tickRate) noexcept;
 
+    //! Returns the number of clock ticks until the next time event
+    //! expires at the given tick rate (0 if no time events are armed).
+    static QTimeEvtCtr nextExpiryX(std::uint_fast8_t const tickRate) noexcept;
+
     //! This function returns the minimum of free entries of the given
     //! event pool.
     static std::uint_fast16_t getPoolMin(std::uint_fast8_t const poolId)
@@ -557,6 +877,17 @@ public:
     //! Recycle a dynamic event.
     static void gc(QEvt const * const e) noexcept;
 
+    //! Internal QF implementation of creating a batch of dynamic events.
+    static std::uint_fast16_t newN_(QEvt * evts[],
+                                    std::uint_fast16_t const n,
+                                    std::uint_fast16_t const evtSize,
+                                    std::uint_fast16_t const margin,
+                                    enum_t const sig) noexcept;
+
+    //! Recycle a batch of dynamic events.
+    static void gcN(QEvt const * const evts[],
+                    std::uint_fast16_t const n) noexcept;
+
     //! Internal QF implementation of creating new event reference.
     static QEvt const *newRef_(QEvt const * const e,
                                QEvt const * const evtRef) noexcept;
@@ -605,6 +936,20 @@ private:
     //! heads of linked lists of time events, one for every clock tick rate
     static QTimeEvt timeEvtHead_[QF_MAX_TICK_RATE];
 
+    //! ticks until the next expiry at @p tickRate (call in crit. section)
+    static QTimeEvtCtr nextExpiry_(std::uint_fast8_t const tickRate) noexcept;
+
+#ifdef QF_TIMEEVT_WHEEL
+    //! slots of the timing wheels, one wheel for every clock tick rate
+    static QTimeEvt * volatile timeEvtWheel_[QF_MAX_TICK_RATE]
+                                            [QF_TIMEEVT_WHEEL];
+#endif
+
+#ifdef QF_MAX_BUFPOOL
+    //! recycle the buffer event @p e (the last reference to it)
+    static void bufEvtRecycle_(QEvt const * const e) noexcept;
+#endif
+
     friend class QActive;
     friend class QTimeEvt;
     friend class QS;
@@ -738,6 +1083,80 @@ public:
                     sizeof(evtT_), (margin_), (sig_))))
 #endif
 
+//! Allocate a batch of dynamic events (non-asserting version).
+//! @description
+//! This macro allocates up to @p n_ new events of the same type and signal
+//! from one event pool at once, while leaving at least @p margin_ of events
+//! still available in the pool.
+//!
+//! @param[out] evts_   array of at least @p n_ pointers to QP::QEvt to
+//!                     receive the allocated events
+//! @param[in]  n_      number of events to allocate
+//! @param[in]  evtT_   event type (class name) of the events to allocate
+//! @param[in]  margin_ number of events that must remain available
+//!                     in the given pool after this allocation. The
+//!                     special value QP::QF_NO_MARGIN causes asserting
+//!                     failure in case not all @p n_ events can be allocated.
+//! @param[in]  sig_    signal to assign to the newly allocated events
+//!
+//! @returns the number of events allocated (the first entries of @p evts_),
+//! which can be less than @p n_ only if @p margin_ != QP::QF_NO_MARGIN.
+//!
+//! @note
+//! The constructors of the events are not invoked, even if #Q_EVT_CTOR
+//! is defined. The events can be recycled one by one (e.g., automatically
+//! after they have been posted or published) or with QP::QF::gcN().
+#define Q_NEW_N(evts_, n_, evtT_, margin_, sig_) \
+    (QP::QF::newN_((evts_), (n_), sizeof(evtT_), (margin_), (sig_)))
+
+#ifdef QF_MAX_BUFPOOL
+//! Allocate a payload buffer for the zero-copy buffer events.
+//! @description
+//! The macro calls the internal QF function QP::QF::newBuf_() with
+//! margin == QP::QF_NO_MARGIN, which causes an assertion when the buffer
+//! cannot be successfully allocated.
+//!
+//! @param[in] size_ the size of the payload data (in bytes)
+//!
+//! @returns a valid pointer to QP::QBuf, which is not referenced by any
+//! buffer event yet. Such a buffer must be either attached to a buffer
+//! event with Q_NEW_BUF_EVT() or recycled with QP::QF::bufGc().
+#define Q_NEW_BUF(size_) (QP::QF::newBuf_((size_), QP::QF_NO_MARGIN))
+
+//! Allocate a payload buffer (non-asserting version).
+//!
+//! @param[out] buf_    pointer to the newly allocated QP::QBuf
+//! @param[in]  size_   the size of the payload data (in bytes)
+//! @param[in]  margin_ number of buffers that must remain available
+//!                     in the given pool after this allocation.
+#define Q_NEW_BUF_X(buf_, size_, margin_) \
+    ((buf_) = QP::QF::newBuf_((size_), (margin_)))
+
+//! Allocate a buffer event referencing the payload buffer @p buf_.
+//! @description
+//! The macro calls the internal QF function QP::QF::newBufEvt_() with
+//! margin == QP::QF_NO_MARGIN, which causes an assertion when the buffer
+//! event cannot be successfully allocated. The same payload buffer can be
+//! referenced by any number of buffer events (e.g., with different signals).
+//!
+//! @param[in] buf_ pointer to the payload buffer to reference
+//! @param[in] sig_ signal to assign to the newly allocated buffer event
+//!
+//! @returns a valid pointer to QP::QBufEvt.
+#define Q_NEW_BUF_EVT(buf_, sig_) \
+    (QP::QF::newBufEvt_((buf_), QP::QF_NO_MARGIN, (sig_)))
+
+//! Allocate a buffer event (non-asserting version).
+//!
+//! @param[out] e_      pointer to the newly allocated QP::QBufEvt
+//! @param[in]  buf_    pointer to the payload buffer to reference
+//! @param[in]  margin_ number of buffer events that must remain available
+//!                     in the pool of buffer events after this allocation.
+//! @param[in]  sig_    signal to assign to the newly allocated buffer event
+#define Q_NEW_BUF_EVT_X(e_, buf_, margin_, sig_) \
+    ((e_) = QP::QF::newBufEvt_((buf_), (margin_), (sig_)))
+#endif // QF_MAX_BUFPOOL
+
 //! Create a new reference of the current event `e` */
 //! @description
 //! The current event processed by an active object is available only for
@@ -808,6 +1227,20 @@ public:
     //! @sa QP::QF::tickX_()
     #define TICK_X(tickRate_, sender_) tickX_((tickRate_), (sender_))
 
+    //! Invoke the clock tick processing QP::QF::tickNX_() for several
+    //! clock ticks at once (e.g., after a tickless sleep).
+    //! @description
+    //! This macro has the same effect as @p nTicks_ invocations of TICK_X(),
+    //! but processes only the ticks in which some time events expire.
+    //!
+    //! @param[in] tickRate_ clock tick rate to be serviced through this call
+    //! @param[in] nTicks_   number of clock ticks elapsed
+    //! @param[in] sender_   pointer to the sender object (used in QS only)
+    //!
+    //! @sa QP::QF::tickNX_(), QP::QF::nextExpiryX()
+    #define TICKN_X(tickRate_, nTicks_, sender_) \
+        tickNX_((tickRate_), (nTicks_), (sender_))
+
     //! Invoke the event publishing facility QP::QF::publish_(). This macro
     //! @description
     //! This macro is the recommended way of publishing events, because it
@@ -895,6 +1328,8 @@ public:
     #define POST(e_, dummy_)            post_((e_), QP::QF_NO_MARGIN)
     #define POST_X(e_, margin_, dummy_) post_((e_), (margin_))
     #define TICK_X(tickRate_, dummy_)   tickX_((tickRate_))
+    #define TICKN_X(tickRate_, nTicks_, dummy_) \
+        tickNX_((tickRate_), (nTicks_))
 
 #endif // Q_SPY
 
@@ -203,7 +203,7 @@ public:
     #define QF_EPOOL_TYPE_  QMPool
     #define QF_EPOOL_INIT_(p_, poolSto_, poolSize_, evtSize_) \
         (p_).init((poolSto_), (poolSize_), (evtSize_))
-    #define QF_EPOOL_EVENT_SIZE_(p_)  ((p_).m_blockSize)
+    #define QF_EPOOL_EVENT_SIZE_(p_)  ((p_).getBlockSize())
     #define QF_EPOOL_GET_(p_, e_, m_, qs_id_) \
         ((e_) = static_cast<QEvt *>((p_).get((m_), (qs_id_))))
     #define QF_EPOOL_PUT_(p_, e_, qs_id_) ((p_).put((e_), (qs_id_)))
@@ -43,6 +43,27 @@
     #define QF_MPOOL_CTR_SIZE 2
 #endif
 
+#ifdef QF_EPOOL_CACHE
+    //! The macro QF_EPOOL_CACHE (if defined in qf_port.hpp or on the
+    //! command line) enables the per-thread caches of blocks in front of
+    //! the QF event pools (see QP::QMPoolCache). The value is the maximum
+    //! number of blocks each thread can cache for each event pool.
+    //! Valid values: [2U..255U]
+    #if (QF_EPOOL_CACHE < 2U) || (QF_EPOOL_CACHE > 255U)
+        #error "QF_EPOOL_CACHE must be in the range 2U..255U"
+    #endif
+#endif
+
+#ifdef QF_MPOOL_LOCKFREE
+    //! The macro QF_MPOOL_LOCKFREE (if defined in qf_port.hpp or on the
+    //! command line) selects the lock-free implementation of QP::QMPool,
+    //! which requires the GCC-compatible atomic built-ins (see NOTE2 in
+    //! qf_mem.cpp).
+    #if (defined QF_EPOOL_CACHE) || (defined QF_ISR_API)
+        #error "QF_MPOOL_LOCKFREE incompatible with QF_EPOOL_CACHE/QF_ISR_API"
+    #endif
+#endif
+
 namespace QP {
 #if (QF_MPOOL_SIZ_SIZE == 1U)
     using QMPoolSize = std::uint8_t;
@@ -74,6 +95,31 @@ namespace QP {
     #error "QF_MPOOL_CTR_SIZE defined incorrectly, expected 1U, 2U, or 4U"
 #endif
 
+#ifdef QF_MPOOL_LOCKFREE
+#if (QF_MPOOL_CTR_SIZE == 4U)
+    using QMPoolHead = std::uint64_t;
+#else
+    //! The data type of the version-tagged head of the lock-free
+    //! QP::QMPool, which holds the index of the first free block in
+    //! the lower half and the ABA tag in the upper half.
+    using QMPoolHead = std::uint32_t;
+#endif
+#endif // QF_MPOOL_LOCKFREE
+
+#ifdef QF_EPOOL_CACHE
+//============================================================================
+//! Per-thread cache of free blocks in front of a QP::QMPool
+//! @description
+//! The cache is a short chain of free blocks owned by one thread, which
+//! allocates and recycles blocks without entering the critical section
+//! of the pool. The blocks are traded with the pool in batches.
+//! @sa QP::QMPool::getCached_(), QP::QMPool::putCached_()
+struct QMPoolCache {
+    void *m_head;        //!< head of the chain of the cached blocks
+    QMPoolCtr m_nBlocks; //!< number of the cached blocks
+};
+#endif // QF_EPOOL_CACHE
+
 //============================================================================
 //! Native QF memory pool class
 //! @description
@@ -104,8 +150,13 @@ private:
     //! end of the memory managed by this memory pool
     void *m_end;
 
+#ifndef QF_MPOOL_LOCKFREE
     //! head of linked list of free blocks
     void * volatile m_free_head;
+#else
+    //! version-tagged index of the head of the list of free blocks
+    QMPoolHead volatile m_free_head;
+#endif
 
     //! maximum block size (in bytes)
     QMPoolSize m_blockSize;
@@ -138,11 +189,37 @@ public:
     //! Returns a memory block back to a memory pool.
     void put(void * const b, std::uint_fast8_t const qs_id) noexcept;
 
+    //! Obtains up to @p n memory blocks from a memory pool at once.
+    std::uint_fast16_t getN(void * blocks[], std::uint_fast16_t const n,
+                            std::uint_fast16_t const margin,
+                            std::uint_fast8_t const qs_id) noexcept;
+
+    //! Returns @p n memory blocks back to a memory pool at once.
+    void putN(void * const blocks[], std::uint_fast16_t const n,
+              std::uint_fast8_t const qs_id) noexcept;
+
     //! return the fixed block-size of the blocks managed by this pool
     QMPoolSize getBlockSize(void) const noexcept {
         return m_blockSize;
     }
 
+#ifdef QF_EPOOL_CACHE
+    //! Obtains a memory block through the per-thread @p cache
+    //! (internal use by the QF event pools only)
+    void *getCached_(QMPoolCache &cache, std::uint_fast16_t const margin,
+                     std::uint_fast8_t const qs_id) noexcept;
+
+    //! Returns a memory block through the per-thread @p cache
+    //! (internal use by the QF event pools only)
+    void putCached_(QMPoolCache &cache, void * const b,
+                    std::uint_fast8_t const qs_id) noexcept;
+
+    //! Returns the blocks in the per-thread @p cache beyond the first
+    //! @p keep blocks back to the pool
+    void flushCache_(QMPoolCache &cache,
+                     std::uint_fast16_t const keep) noexcept;
+#endif // QF_EPOOL_CACHE
+
 // duplicated API to be used exclusively inside ISRs (useful in some QP ports)
 #ifdef QF_ISR_API
     void *getFromISR(std::uint_fast16_t const margin,
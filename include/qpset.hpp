@@ -26,7 +26,7 @@
 //! @version Last updated for: @ref qpcpp_7_0_0
 //!
 //! @file
-//! @brief platform-independent priority sets of 8 or 64 elements.
+//! @brief platform-independent priority sets of 8, 64, or 255 elements.
 
 #ifndef QPSET_HPP
 #define QPSET_HPP
@@ -38,8 +38,8 @@
 
 namespace QP {
 
-#if (QF_MAX_ACTIVE < 1U) || (64U < QF_MAX_ACTIVE)
-    #error "QF_MAX_ACTIVE out of range. Valid range is 1U..64U"
+#if (QF_MAX_ACTIVE < 1U) || (255U < QF_MAX_ACTIVE)
+    #error "QF_MAX_ACTIVE out of range. Valid range is 1U..255U"
 #elif (QF_MAX_ACTIVE <= 8U)
     using QPSetBits = std::uint8_t;
 #elif (QF_MAX_ACTIVE <= 16U)
@@ -51,10 +51,42 @@ namespace QP {
 
 //============================================================================
 // Log-base-2 calculations ...
+#if (!defined QF_LOG2) && (defined __GNUC__) && (!defined QF_PSET_PORTABLE)
+
+    //! (log2(x) + 1) with the count-leading-zeros builtin of GCC/Clang,
+    //! returns 0 for x == 0 (see NOTE2)
+    inline std::uint_fast8_t QF_clzLog2_(std::uint32_t const x) noexcept {
+        return (x != 0U)
+               ? static_cast<std::uint_fast8_t>(
+                     32 - __builtin_clz(static_cast<unsigned>(x)))
+               : 0U;
+    }
+    #define QF_LOG2(n_) (QP::QF_clzLog2_(static_cast<std::uint32_t>(n_)))
+
+#endif // GCC/Clang builtins
+
 #ifndef QF_LOG2
     extern "C" std::uint_fast8_t QF_LOG2(QPSetBits x) noexcept;
 #endif // QF_LOG2
 
+//! number of 1-bits in a 32-bit bitmask (population count)
+inline std::uint_fast8_t QF_bitCount_(std::uint32_t x) noexcept {
+#if (defined __GNUC__) && (!defined QF_PSET_PORTABLE)
+    return static_cast<std::uint_fast8_t>(
+               __builtin_popcount(static_cast<unsigned>(x)));
+#else
+    x = x - ((x >> 1U) & 0x55555555U);
+    x = (x & 0x33333333U) + ((x >> 2U) & 0x33333333U);
+    x = (x + (x >> 4U)) & 0x0F0F0F0FU;
+    return static_cast<std::uint_fast8_t>((x * 0x01010101U) >> 24U);
+#endif
+}
+
+//! bitmask of the elements 1..n (bits 0..n-1), n = 0..31
+inline std::uint32_t QF_bitsBelow_(std::uint_fast8_t const n) noexcept {
+    return (static_cast<std::uint32_t>(1) << n) - 1U;
+}
+
 //============================================================================
 #if (QF_MAX_ACTIVE <= 32)
 //! Priority Set of up to 32 elements */
@@ -103,12 +135,124 @@ struct QPSet {
            static_cast<QPSetBits>(~(static_cast<QPSetBits>(1) << (n - 1U))));
     }
 
+    //! find the maximum element in the set, returns zero if the set is empty
     std::uint_fast8_t findMax(void) const noexcept {
         return QF_LOG2(m_bits);
     }
+
+    //! find the maximum element below @p n, returns zero if there is none
+    //! @description
+    //! Iterates over the set in the descending order without modifying it:
+    //! `for (p = s.findMax(); p != 0U; p = s.findMaxBelow(p)) {...}`
+    std::uint_fast8_t findMaxBelow(std::uint_fast8_t const n) const noexcept {
+        return QF_LOG2(static_cast<std::uint32_t>(m_bits)
+                       & QF_bitsBelow_(n - 1U));
+    }
+
+    //! the number of elements in the set
+    std::uint_fast8_t count(void) const noexcept {
+        return QF_bitCount_(m_bits);
+    }
+
+    //! insert all elements of the set @p other into this set
+    void unionWith(QPSet const &other) noexcept {
+        m_bits = (m_bits | other.m_bits);
+    }
+
+    //! remove all elements not present in the set @p other from this set
+    void intersectWith(QPSet const &other) noexcept {
+        m_bits = (m_bits & other.m_bits);
+    }
+};
+
+#elif (QF_MAX_ACTIVE <= 64U) && (defined __GNUC__) \
+      && (__SIZEOF_POINTER__ == 8) && (!defined QF_PSET_PORTABLE)
+
+//! Priority Set of up to 64 elements in a native 64-bit word
+//!
+//! The priority set represents the set of active objects that are ready to
+//! run and need to be considered by the scheduling algorithm. This variant
+//! of QP::QPSet is used on 64-bit GCC/Clang targets, where every operation
+//! is a single 64-bit word operation (see NOTE2). QP::QPSet is specifically
+//! declared as a POD (Plain Old Data) for ease of initialization and
+//! interfacing with plain "C" code.
+//!
+struct QPSet {
+
+    //! 64-bit bitmask with a bit for each element
+    std::uint64_t volatile m_bits;
+
+    //! Makes the priority set @p me_ empty.
+    void setEmpty(void) noexcept {
+        m_bits = 0U;
+    }
+
+    //! Evaluates to true if the priority set is empty
+    bool isEmpty(void) const noexcept {
+        return (m_bits == 0U);
+    }
+
+    //! Evaluates to true if the priority set is not empty
+    bool notEmpty(void) const noexcept {
+        return (m_bits != 0U);
+    }
+
+    //! the function evaluates to TRUE if the priority set has the element n.
+    bool hasElement(std::uint_fast8_t const n) const noexcept {
+        return (m_bits & (static_cast<std::uint64_t>(1) << (n - 1U))) != 0U;
+    }
+
+    //! insert element @p n into the set, n = 1..64
+    void insert(std::uint_fast8_t const n) noexcept {
+        m_bits = (m_bits | (static_cast<std::uint64_t>(1) << (n - 1U)));
+    }
+
+    //! remove element @p n from the set, n = 1..64
+    //! @note
+    //! intentionally misspelled ("rmove") to avoid collision with
+    //! the C++ standard library facility "remove"
+    void rmove(std::uint_fast8_t const n) noexcept {
+        m_bits = (m_bits & ~(static_cast<std::uint64_t>(1) << (n - 1U)));
+    }
+
+    //! find the maximum element in the set, returns zero if the set is empty
+    std::uint_fast8_t findMax(void) const noexcept {
+        return log2_(m_bits);
+    }
+
+    //! find the maximum element below @p n, returns zero if there is none
+    //! @description
+    //! Iterates over the set in the descending order without modifying it:
+    //! `for (p = s.findMax(); p != 0U; p = s.findMaxBelow(p)) {...}`
+    std::uint_fast8_t findMaxBelow(std::uint_fast8_t const n) const noexcept {
+        return log2_(m_bits
+                     & ((static_cast<std::uint64_t>(1) << (n - 1U)) - 1U));
+    }
+
+    //! the number of elements in the set
+    std::uint_fast8_t count(void) const noexcept {
+        return static_cast<std::uint_fast8_t>(__builtin_popcountll(m_bits));
+    }
+
+    //! insert all elements of the set @p other into this set
+    void unionWith(QPSet const &other) noexcept {
+        m_bits = (m_bits | other.m_bits);
+    }
+
+    //! remove all elements not present in the set @p other from this set
+    void intersectWith(QPSet const &other) noexcept {
+        m_bits = (m_bits & other.m_bits);
+    }
+
+    //! (log2(x) + 1) of a 64-bit bitmask, returns 0 for x == 0
+    static std::uint_fast8_t log2_(std::uint64_t const x) noexcept {
+        return (x != 0U)
+               ? static_cast<std::uint_fast8_t>(64 - __builtin_clzll(x))
+               : 0U;
+    }
 };
 
-#else // QF_MAX_ACTIVE > 32U
+#elif (QF_MAX_ACTIVE <= 64U)
 
 //! Priority Set of up to 64 elements
 //!
@@ -183,10 +327,202 @@ struct QPSet {
             ? (QF_LOG2(m_bits[1]) + 32U)
             : (QF_LOG2(m_bits[0]));
     }
+
+    //! find the maximum element below @p n, returns zero if there is none
+    //! @description
+    //! Iterates over the set in the descending order without modifying it:
+    //! `for (p = s.findMax(); p != 0U; p = s.findMaxBelow(p)) {...}`
+    std::uint_fast8_t findMaxBelow(std::uint_fast8_t const n) const noexcept {
+        std::uint_fast8_t p;
+        if (n <= 32U) {
+            p = QF_LOG2(m_bits[0] & QF_bitsBelow_(n - 1U));
+        }
+        else {
+            std::uint32_t const hi = (m_bits[1] & QF_bitsBelow_(n - 33U));
+            p = (hi != 0U)
+                ? (QF_LOG2(hi) + 32U)
+                : (QF_LOG2(m_bits[0]));
+        }
+        return p;
+    }
+
+    //! the number of elements in the set
+    std::uint_fast8_t count(void) const noexcept {
+        return QF_bitCount_(m_bits[0]) + QF_bitCount_(m_bits[1]);
+    }
+
+    //! insert all elements of the set @p other into this set
+    void unionWith(QPSet const &other) noexcept {
+        m_bits[0] = (m_bits[0] | other.m_bits[0]);
+        m_bits[1] = (m_bits[1] | other.m_bits[1]);
+    }
+
+    //! remove all elements not present in the set @p other from this set
+    void intersectWith(QPSet const &other) noexcept {
+        m_bits[0] = (m_bits[0] & other.m_bits[0]);
+        m_bits[1] = (m_bits[1] & other.m_bits[1]);
+    }
+};
+
+#else // QF_MAX_ACTIVE > 64U
+
+//! Hierarchical Priority Set of up to 255 elements (see NOTE1)
+//!
+//! The priority set represents the set of active objects that are ready to
+//! run and need to be considered by the scheduling algorithm. This variant
+//! of QP::QPSet is used when #QF_MAX_ACTIVE exceeds 64. It consists of
+//! 32-bit leaf words with a bit for each element, and a summary word with
+//! a bit for each non-empty leaf, so that all operations take constant
+//! time regardless of the number of elements. QP::QPSet is specifically
+//! declared as a POD (Plain Old Data) for ease of initialization and
+//! interfacing with plain "C" code.
+//!
+struct QPSet {
+
+    //! number of 32-bit leaf words
+    enum : std::uint_fast8_t { LEAVES = (QF_MAX_ACTIVE + 31U) / 32U };
+
+    //! summary bitmask with bit (i) set when the leaf m_bits[i] is not empty
+    std::uint32_t volatile m_summary;
+
+    //! 32-bit leaf bitmasks with a bit for each element
+    std::uint32_t volatile m_bits[LEAVES];
+
+    //! Makes the priority set @p me_ empty.
+    void setEmpty(void) noexcept {
+        m_summary = 0U;
+        for (std::uint_fast8_t i = 0U; i < LEAVES; ++i) {
+            m_bits[i] = 0U;
+        }
+    }
+
+    //! Evaluates to true if the priority set is empty
+    bool isEmpty(void) const noexcept {
+        return (m_summary == 0U);
+    }
+
+    //! Evaluates to true if the priority set is not empty
+    bool notEmpty(void) const noexcept {
+        return (m_summary != 0U);
+    }
+
+    //! the function evaluates to TRUE if the priority set has the element n.
+    bool hasElement(std::uint_fast8_t const n) const noexcept {
+        return (m_bits[(n - 1U) >> 5U]
+                & (static_cast<std::uint32_t>(1) << ((n - 1U) & 0x1FU)))
+               != 0U;
+    }
+
+    //! insert element @p n into the set, n = 1..QF_MAX_ACTIVE
+    void insert(std::uint_fast8_t const n) noexcept {
+        std::uint_fast8_t const i =
+            static_cast<std::uint_fast8_t>((n - 1U) >> 5U);
+        m_bits[i] = (m_bits[i]
+            | (static_cast<std::uint32_t>(1) << ((n - 1U) & 0x1FU)));
+        m_summary = (m_summary | (static_cast<std::uint32_t>(1) << i));
+    }
+
+    //! remove element @p n from the set, n = 1..QF_MAX_ACTIVE
+    //! @note
+    //! intentionally misspelled ("rmove") to avoid collision with
+    //! the C++ standard library facility "remove"
+    void rmove(std::uint_fast8_t const n) noexcept {
+        std::uint_fast8_t const i =
+            static_cast<std::uint_fast8_t>((n - 1U) >> 5U);
+        m_bits[i] = (m_bits[i]
+            & ~(static_cast<std::uint32_t>(1) << ((n - 1U) & 0x1FU)));
+        if (m_bits[i] == 0U) {
+            m_summary = (m_summary
+                & ~(static_cast<std::uint32_t>(1) << i));
+        }
+    }
+
+    //! find the maximum element in the set, returns zero if the set is empty
+    std::uint_fast8_t findMax(void) const noexcept {
+        std::uint_fast8_t p = 0U;
+        if (m_summary != 0U) {
+            std::uint_fast8_t const i =
+                static_cast<std::uint_fast8_t>(QF_LOG2(m_summary) - 1U);
+            p = static_cast<std::uint_fast8_t>(QF_LOG2(m_bits[i]) + (i << 5U));
+        }
+        return p;
+    }
+
+    //! find the maximum element below @p n, returns zero if there is none
+    //! @description
+    //! Iterates over the set in the descending order without modifying it:
+    //! `for (p = s.findMax(); p != 0U; p = s.findMaxBelow(p)) {...}`
+    std::uint_fast8_t findMaxBelow(std::uint_fast8_t const n) const noexcept {
+        std::uint_fast8_t i = static_cast<std::uint_fast8_t>((n - 1U) >> 5U);
+        std::uint32_t const leaf =
+            (m_bits[i] & QF_bitsBelow_((n - 1U) & 0x1FU));
+        std::uint_fast8_t p = 0U;
+        if (leaf != 0U) {
+            p = static_cast<std::uint_fast8_t>(QF_LOG2(leaf) + (i << 5U));
+        }
+        else {
+            std::uint32_t const below = (m_summary & QF_bitsBelow_(i));
+            if (below != 0U) {
+                i = static_cast<std::uint_fast8_t>(QF_LOG2(below) - 1U);
+                p = static_cast<std::uint_fast8_t>(
+                        QF_LOG2(m_bits[i]) + (i << 5U));
+            }
+        }
+        return p;
+    }
+
+    //! the number of elements in the set
+    std::uint_fast8_t count(void) const noexcept {
+        std::uint_fast8_t n = 0U;
+        for (std::uint_fast8_t i = 0U; i < LEAVES; ++i) {
+            n += QF_bitCount_(m_bits[i]);
+        }
+        return n;
+    }
+
+    //! insert all elements of the set @p other into this set
+    void unionWith(QPSet const &other) noexcept {
+        for (std::uint_fast8_t i = 0U; i < LEAVES; ++i) {
+            m_bits[i] = (m_bits[i] | other.m_bits[i]);
+        }
+        m_summary = (m_summary | other.m_summary);
+    }
+
+    //! remove all elements not present in the set @p other from this set
+    void intersectWith(QPSet const &other) noexcept {
+        std::uint32_t summary = 0U;
+        for (std::uint_fast8_t i = 0U; i < LEAVES; ++i) {
+            m_bits[i] = (m_bits[i] & other.m_bits[i]);
+            if (m_bits[i] != 0U) {
+                summary |= (static_cast<std::uint32_t>(1) << i);
+            }
+        }
+        m_summary = summary;
+    }
 };
 
 #endif // QF_MAX_ACTIVE
 
 } // namespace QP
 
+//============================================================================
+// NOTE1:
+// The upper limit of 255 elements comes from the 8-bit QF priority stored
+// in QP::QActive::m_prio and reported in the QS trace records, not from
+// the hierarchical QP::QPSet itself, whose 32-bit summary word could index
+// up to 1024 elements. Just like the flat variants, the hierarchical
+// QP::QPSet is not thread-safe and must be accessed inside critical
+// sections, because insert() and rmove() update the leaf and the summary
+// words in two separate steps.
+//
+// NOTE2:
+// On GCC/Clang, QF_LOG2() (unless already defined in the QF port) and
+// QP::QPSet::count() use the count-leading-zeros and population-count
+// builtins, which compile to single instructions (e.g., LZCNT/POPCNT,
+// CLZ) where the CPU has them. On 64-bit targets, the QP::QPSet of up to
+// 64 elements also uses a single native 64-bit word instead of two 32-bit
+// words. Defining the macro QF_PSET_PORTABLE selects the portable
+// implementation instead, for example to compare the performance.
+//
+
 #endif // QPSET_HPP
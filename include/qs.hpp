@@ -152,6 +152,10 @@ enum QSpyRecords : std::int8_t {
     QS_PEEK_DATA,         //!< reports the data from the PEEK query
     QS_ASSERT_FAIL,       //!< assertion failed in the code
     QS_QF_RUN,            //!< QF_run() was entered
+
+    // [71] Additional QF records
+    QS_QF_TICK_OVERRUN,   //!< clock tick(s) missed by the QF port
+    QS_QF_ACTIVE_CONFLATE, //!< pending evt replaced in a conflating AO queue
 };
 
 //! QS user record group offsets for QS_GLB_FILTER()
@@ -183,6 +187,10 @@ enum QSpyRecordGroups : std::int16_t {
 };
 
 //! QS ID offsets for QS_LOC_FILTER()
+//! @note
+//! With #QF_MAX_ACTIVE above 64, the AO priorities 64..127 share the local
+//! filter bits with the event-pool, event-queue, and application-specific
+//! IDs, and the AO priorities above 127 cannot be filtered locally.
 enum QSpyIdOffsets : std::int16_t {
     QS_AO_ID = 0,  //!< offset for AO priorities
     QS_EP_ID = 64, //!< offset for event-pool IDs
@@ -701,12 +709,23 @@ extern std::uint8_t volatile QF_intNest;
           & (static_cast<std::uint_fast8_t>(1U)                 \
             << (static_cast<std::uint_fast8_t>(rec_) & 7U))) != 0U)
 
+#if (QF_MAX_ACTIVE <= 64U)
 //! helper macro for checking the local QS filter
 #define QS_LOC_CHECK_(qs_id_)                                   \
     ((static_cast<std::uint_fast8_t>(QP::QS::priv_.locFilter    \
                 [static_cast<std::uint_fast8_t>(qs_id_) >> 3U]) \
           & (static_cast<std::uint_fast8_t>(1U)                 \
             << (static_cast<std::uint_fast8_t>(qs_id_) & 7U))) != 0U)
+#else
+// QS IDs above 127 (AO priorities above 127) have no local filter bits,
+// so they are always enabled; see QP::QSpyIdOffsets
+#define QS_LOC_CHECK_(qs_id_)                                   \
+    ((static_cast<std::uint_fast8_t>(qs_id_) > 0x7FU)           \
+      || ((static_cast<std::uint_fast8_t>(QP::QS::priv_.locFilter \
+                [static_cast<std::uint_fast8_t>(qs_id_) >> 3U]) \
+          & (static_cast<std::uint_fast8_t>(1U)                 \
+            << (static_cast<std::uint_fast8_t>(qs_id_) & 7U))) != 0U))
+#endif // QF_MAX_ACTIVE
 
 //============================================================================
 // Facilities for QS ciritical section
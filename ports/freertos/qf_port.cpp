@@ -293,7 +293,7 @@ void QF::publishFromISR_(QEvt const *e, void *par) noexcept
     }
 
     // make a local, modifiable copy of the subscriber list
-    QPSet subscrList = QF_subscrList_[e->sig];
+    QPSet subscrList = QF_PS_LIST_(e->sig);
     taskEXIT_CRITICAL_FROM_ISR(uxSavedInterruptState);
 
     if (subscrList.notEmpty()) {
@@ -305,8 +305,10 @@ void QF::publishFromISR_(QEvt const *e, void *par) noexcept
             // the prio of the AO must be registered with the framework
             Q_ASSERT_ID(510, active_[p] != nullptr);
 
-            // POST_FROM_ISR() asserts internally if the queue overflows
-            (void)active_[p]->POST_FROM_ISR(e, par, sender);
+            if (QF_PS_ACCEPTS_(active_[p], e)) { // not filtered out?
+                // POST_FROM_ISR() asserts internally if the queue overflows
+                (void)active_[p]->POST_FROM_ISR(e, par, sender);
+            }
 
             subscrList.rmove(p); // remove the handled subscriber
             if (subscrList.notEmpty()) {  // still more subscribers?
@@ -429,14 +431,9 @@ QEvt *QF::newXfromISR_(std::uint_fast16_t const evtSize,
                        std::uint_fast16_t const margin,
                        enum_t const sig) noexcept
 {
-    std::uint_fast8_t idx;
-
     // find the pool id that fits the requested event size ...
-    for (idx = 0U; idx < QF_maxPool_; ++idx) {
-        if (evtSize <= QF_EPOOL_EVENT_SIZE_(QF_pool_[idx])) {
-            break;
-        }
-    }
+    std::uint_fast8_t const idx = QF_poolFind_(evtSize);
+
     // cannot run out of registered pools
     Q_ASSERT_ID(710, idx < QF_maxPool_);
 
@@ -523,6 +520,50 @@ void QF::gcFromISR(QEvt const * const e) noexcept {
 
             taskEXIT_CRITICAL_FROM_ISR(uxSavedInterruptState);
 
+#ifdef QF_MAX_BUFPOOL
+            if (e->poolId_ == QF_BUF_EVT_POOL_ID) { // a buffer event?
+                QBuf * const buf = static_cast<QBufEvt const *>(e)->buf;
+
+#ifdef Q_EVT_VIRTUAL
+                // explicitly exectute the destructor'
+                // NOTE: casting 'const' away is legitimate,
+                // because it's a pool event
+                QF_EVT_CONST_CAST_(e)->~QEvt(); // xtor,
+#endif
+
+#ifdef Q_SPY
+                QF_bufEvtPool_.putFromISR(QF_EVT_CONST_CAST_(e),
+                    static_cast<uint_fast8_t>(QS_EP_ID) + QF_BUF_EVT_POOL_ID);
+#else
+                QF_bufEvtPool_.putFromISR(QF_EVT_CONST_CAST_(e), 0U);
+#endif
+
+                // release the reference to the payload buffer
+#ifdef QF_EVT_REF_ATOMIC
+                bool const isLast =
+                    (QF_refCtrRelease_(&buf->m_refCtr) <= 1U);
+#else
+                uxSavedInterruptState = taskENTER_CRITICAL_FROM_ISR();
+                bool const isLast = (buf->m_refCtr <= 1U);
+                if (!isLast) {
+                    --buf->m_refCtr;
+                }
+                taskEXIT_CRITICAL_FROM_ISR(uxSavedInterruptState);
+#endif
+
+                if (isLast) { // the last reference to this buffer?
+#ifdef Q_SPY
+                    QF_bufPool_[buf->m_poolId - 1U].putFromISR(buf,
+                        static_cast<uint_fast8_t>(QS_EP_ID)
+                        + QF_BUF_EVT_POOL_ID);
+#else
+                    QF_bufPool_[buf->m_poolId - 1U].putFromISR(buf, 0U);
+#endif
+                }
+                return;
+            }
+#endif // QF_MAX_BUFPOOL
+
             // pool ID must be in range
             Q_ASSERT_ID(810, idx < QF_maxPool_);
 
@@ -61,7 +61,7 @@
 #define QF_CRIT_ENTRY(dummy) QF_INT_DISABLE()
 #define QF_CRIT_EXIT(dummy)  QF_INT_ENABLE()
 
-// QF_LOG2 not defined -- use the internal LOG2() implementation
+// QF_LOG2 not defined -- QPSet uses the GCC/Clang builtins (see qpset.hpp)
 
 #include "qep_port.hpp"  // QEP port
 #include "qequeue.hpp"   // QUTEST port uses QEQueue event-queue
@@ -57,6 +57,8 @@
 #include <string.h>         // for memcpy() and memset()
 #include <stdlib.h>
 #include <stdio.h>
+#include <errno.h>          // for ETIMEDOUT
+#include <time.h>           // for clock_nanosleep()
 #include <termios.h>
 #include <unistd.h>
 #include <signal.h>
@@ -67,17 +69,38 @@ Q_DEFINE_THIS_MODULE("qf_port")
 
 /* Global objects ==========================================================*/
 QPSet  QV_readySet_;        // QV-ready set of active objects
+QPSet  QV_busySet_;         // AOs currently executing RTC steps, NOTE06
 pthread_cond_t QV_condVar_; // Cond.var. to signal events
 
 // Local objects *************************************************************
 static pthread_mutex_t l_pThreadMutex; // POSIX mutex for the QF crit. section
 static bool l_isRunning;    // flag indicating when QF is running
+static bool l_isStopping;   // QF::stop() called (in the critical section)
 static struct termios l_tsav; // structure with saved terminal attributes
 static struct timespec l_tick;
 static int_t l_tickPrio;
+static QTimeEvtCtr l_clockTicks = 1U; // ticks for the QF_onClockTick() call
+static std::int64_t l_lastTick;       // time of the last clock tick [ns]
+static QF_TickStats l_tickStats;      // clock tick statistics, see NOTE07
+static std::uint_fast8_t l_nWorkers = 1U; // number of worker threads
 enum { NANOSLEEP_NSEC_PER_SEC = 1000000000 }; // see NOTE05
+enum { QV_MAX_WORKERS = 64 }; // maximum number of worker threads
+
+#ifdef QF_TICKLESS
+static pthread_mutex_t l_tickMutex; // mutex protecting the tickless sleep
+static pthread_cond_t  l_tickCond;  // cond. var. to wake up the ticker
+static bool l_tickWakeup;           // time event armed during the sleep
+
+static QTimeEvtCtr ticklessSleep(void);
+#else
+static std::uint32_t tickSleep(void);
+#endif // QF_TICKLESS
+
+static std::int64_t monotonicTime(void);
 
 static void *ticker_thread(void *arg);
+static void *worker_thread(void *arg);
+static void worker_loop(void);
 static void sigIntHandler(int /* dummy */);
 
 //============================================================================
@@ -90,6 +113,17 @@ void QF::init(void) {
 
     // init the global condition variable with the default initializer
     pthread_cond_init(&QV_condVar_, NULL);
+    l_isStopping = false; // not stopped yet (see QF::stop())
+
+#ifdef QF_TICKLESS
+    // init the tickless sleep, which measures time with CLOCK_MONOTONIC
+    pthread_mutex_init(&l_tickMutex, NULL);
+    pthread_condattr_t condAttr;
+    pthread_condattr_init(&condAttr);
+    pthread_condattr_setclock(&condAttr, CLOCK_MONOTONIC);
+    pthread_cond_init(&l_tickCond, &condAttr);
+    pthread_condattr_destroy(&condAttr);
+#endif // QF_TICKLESS
 
     l_tick.tv_sec = 0;
     l_tick.tv_nsec = NANOSLEEP_NSEC_PER_SEC/100L; // default clock tick
@@ -157,53 +191,24 @@ int_t QF::run(void) {
         pthread_attr_destroy(&attr);
     }
 
-    // the combined event-loop and background-loop of the QV kernel */
-    QF_CRIT_STAT_
-    QF_CRIT_E_();
-
     // produce the QS_QF_RUN trace record
-    QS_BEGIN_NOCRIT_PRE_(QS_QF_RUN, 0U)
-    QS_END_NOCRIT_PRE_()
-
-    while (l_isRunning) {
-
-        if (QV_readySet_.notEmpty()) {
-            std::uint_fast8_t p = QV_readySet_.findMax();
-            QActive *a = active_[p];
-            QF_CRIT_X_();
-
-            // the active object 'a' must still be registered in QF
-            // (e.g., it must not be stopped)
-            Q_ASSERT_ID(320, a != nullptr);
-
-            // perform the run-to-completion (RTS) step...
-            // 1. retrieve the event from the AO's event queue, which by this
-            //    time must be non-empty and The "Vanialla" kernel asserts it.
-            // 2. dispatch the event to the AO's state machine.
-            // 3. determine if event is garbage and collect it if so
-            //
-            QEvt const *e = a->get_();
-            a->dispatch(e, a->m_prio);
-            gc(e);
+    QS_CRIT_STAT_
+    QS_BEGIN_PRE_(QS_QF_RUN, 0U)
+    QS_END_PRE_()
+
+    // start the additional worker threads, see NOTE06
+    pthread_t workers[QV_MAX_WORKERS];
+    for (std::uint_fast8_t n = 1U; n < l_nWorkers; ++n) {
+        int err = pthread_create(&workers[n], nullptr, &worker_thread, 0);
+        Q_ASSERT_ID(330, err == 0); // worker thread must be created
+    }
 
-            QF_CRIT_E_();
+    worker_loop(); // the QF::run() thread is the first worker
 
-            if (a->m_eQueue.isEmpty()) { /* empty queue? */
-                QV_readySet_.rmove(p);
-            }
-        }
-        else {
-            // the QV kernel in embedded systems calls here the QV_onIdle()
-            // callback. However, the POSIX-QV port does not do busy-waiting
-            // for events. Instead, the POSIX-QV port efficiently waits until
-            // QP events become available.
-            //
-            while (QV_readySet_.isEmpty()) {
-                pthread_cond_wait(&QV_condVar_, &l_pThreadMutex);
-            }
-        }
+    for (std::uint_fast8_t n = 1U; n < l_nWorkers; ++n) {
+        pthread_join(workers[n], nullptr);
     }
-    QF_CRIT_X_();
+
     onCleanup();  // cleanup callback
     QS_EXIT();    // cleanup the QSPY connection
 
@@ -223,12 +228,48 @@ void QF_setTickRate(std::uint32_t ticksPerSec, int_t tickPrio) {
     l_tickPrio = tickPrio;
 }
 //............................................................................
+QTimeEvtCtr QF_clockTicks(void) {
+    return l_clockTicks;
+}
+//............................................................................
+void QF_getTickStats(QF_TickStats * const stats, bool const reset) {
+    QF_CRIT_STAT_
+    QF_CRIT_E_();
+    *stats = l_tickStats;
+    if (reset) {
+        memset(&l_tickStats, 0, sizeof(l_tickStats));
+    }
+    QF_CRIT_X_();
+}
+//............................................................................
+void QF_setWorkers(std::uint_fast8_t nWorkers) {
+    if (nWorkers == 0U) { // use one worker per available CPU core?
+        long nCores = sysconf(_SC_NPROCESSORS_ONLN);
+        if (nCores < 1) {
+            nCores = 1;
+        }
+        else if (nCores > static_cast<long>(QV_MAX_WORKERS)) {
+            nCores = static_cast<long>(QV_MAX_WORKERS);
+        }
+        nWorkers = static_cast<std::uint_fast8_t>(nCores);
+    }
+    Q_REQUIRE_ID(200, nWorkers <= QV_MAX_WORKERS);
+    l_nWorkers = nWorkers;
+}
+//............................................................................
 void QF::stop(void) {
-    l_isRunning = false; // terminate the main event-loop thread
+    l_isRunning = false; // terminate the ticker thread
+
+    // terminate the workers and unblock the idle ones
+    QF_CRIT_STAT_
+    QF_CRIT_E_();
+    l_isStopping = true;
+    pthread_cond_broadcast(&QV_condVar_);
+    QF_CRIT_X_();
 
-    // unblock the event-loop so it can terminate
-    QV_readySet_.insert(1);
-    pthread_cond_signal(&QV_condVar_);
+#ifdef QF_TICKLESS
+    QF_tickWakeup_(); // unblock the ticker thread
+#endif
 }
 //............................................................................
 void QF_consoleSetup(void) {
@@ -294,15 +335,232 @@ void QActive::stop(void) {
 }
 #endif
 
+//============================================================================
+// the combined event-loop and background-loop of the QV kernel executed by
+// every worker thread, see NOTE06
+static void worker_loop(void) {
+    QF_CRIT_STAT_
+    QF_CRIT_E_();
+    while (!l_isStopping) {
+
+        if (QV_readySet_.notEmpty()) {
+            std::uint_fast8_t p = QV_readySet_.findMax();
+            QActive *a = QF::active_[p];
+
+            // the AO is now executing on this worker, so that no other
+            // worker can pick it until its RTC step completes
+            QV_readySet_.rmove(p);
+            QV_busySet_.insert(p);
+
+            // more ready AOs? wake up another worker to take them
+            if (QV_readySet_.notEmpty()) {
+                pthread_cond_signal(&QV_condVar_);
+            }
+            QF_CRIT_X_();
+
+            // the active object 'a' must still be registered in QF
+            // (e.g., it must not be stopped)
+            Q_ASSERT_ID(320, a != nullptr);
+
+            // perform the run-to-completion (RTS) step...
+            // 1. retrieve the event from the AO's event queue, which by this
+            //    time must be non-empty and The "Vanialla" kernel asserts it.
+            // 2. dispatch the event to the AO's state machine.
+            // 3. determine if event is garbage and collect it if so
+            //
+            QEvt const *e = a->get_();
+            a->dispatch(e, a->m_prio);
+            QF::gc(e);
+
+#ifdef QF_ACTIVE_BATCH
+            // dispatch more events to the same AO within its batch budget,
+            // without re-evaluating the priorities. The emptiness check
+            // needs no critical section, because only the AO itself can
+            // empty its queue.
+            for (std::uint_fast8_t n = a->m_batch;
+                 (n > 1U) && (!a->m_eQueue.isEmpty())
+                             && (QF::active_[p] == a);
+                 --n)
+            {
+                e = a->get_();
+                a->dispatch(e, a->m_prio);
+                QF::gc(e);
+            }
+#endif
+
+            QF_CRIT_E_();
+            QV_busySet_.rmove(p);
+
+            // more events for the AO (and the AO not stopped)?
+            if ((!a->m_eQueue.isEmpty()) && (QF::active_[p] == a)) {
+                QV_readySet_.insert(p);
+            }
+        }
+        else {
+            // the QV kernel in embedded systems calls here the QV_onIdle()
+            // callback. However, the POSIX-QV port does not do busy-waiting
+            // for events. Instead, the POSIX-QV port efficiently waits until
+            // QP events become available.
+            //
+            while (QV_readySet_.isEmpty() && (!l_isStopping)) {
+                pthread_cond_wait(&QV_condVar_, &l_pThreadMutex);
+            }
+        }
+    }
+    QF_CRIT_X_();
+}
+//............................................................................
+static void *worker_thread(void * /*arg*/) { // for pthread_create()
+    worker_loop();
+    return nullptr; // return success
+}
+
 //============================================================================
 static void *ticker_thread(void * /*arg*/) { // for pthread_create()
+    l_lastTick = monotonicTime();
+#ifndef QF_TICKLESS
     while (l_isRunning) { // the clock tick loop...
-        nanosleep(&l_tick, NULL); // sleep for the number of ticks, NOTE05
-        QF_onClockTick(); // clock tick callback (must call QF_TICK_X())
+        // call the clock tick callback for every due tick, see NOTE07
+        for (std::uint32_t n = tickSleep(); (n != 0U) && l_isRunning; --n) {
+            QF_onClockTick(); // clock tick callback (must call QF_TICK_X())
+        }
     }
+#else
+    while (l_isRunning) { // the tickless clock loop, see NOTE2
+        l_clockTicks = ticklessSleep();
+        if ((l_clockTicks != 0U) && l_isRunning) {
+            QF_onClockTick(); // clock tick callback (must call TICKN_X())
+        }
+    }
+#endif // QF_TICKLESS
     return nullptr; // return success
 }
 
+//============================================================================
+// clock tick helpers
+//............................................................................
+// the current time of the CLOCK_MONOTONIC clock [ns]
+static std::int64_t monotonicTime(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<std::int64_t>(now.tv_sec)*NANOSLEEP_NSEC_PER_SEC
+           + now.tv_nsec;
+}
+//............................................................................
+// the period of the clock tick [ns]
+static std::int64_t tickPeriod(void) {
+    return static_cast<std::int64_t>(l_tick.tv_sec)*NANOSLEEP_NSEC_PER_SEC
+           + l_tick.tv_nsec;
+}
+//............................................................................
+// convert the CLOCK_MONOTONIC time @p t [ns] to struct timespec
+static struct timespec toTimespec(std::int64_t const t) {
+    struct timespec ts;
+    ts.tv_sec  = static_cast<time_t>(t / NANOSLEEP_NSEC_PER_SEC);
+    ts.tv_nsec = static_cast<long>(t % NANOSLEEP_NSEC_PER_SEC);
+    return ts;
+}
+//............................................................................
+// account for @p nTicks clock ticks processed after waking up @p late [ns]
+// past the deadline (negative @p late means no deadline), see NOTE07
+static void tickStats(std::int64_t const late, std::uint32_t const nTicks) {
+    QF_CRIT_STAT_
+    QF_CRIT_E_();
+    l_tickStats.nTicks += nTicks;
+    if (late >= 0) {
+        std::uint32_t const missed =
+            static_cast<std::uint32_t>(late / tickPeriod());
+        std::uint32_t const jitter = (late < 0xFFFFFFFF)
+            ? static_cast<std::uint32_t>(late)
+            : 0xFFFFFFFFU;
+        l_tickStats.nOverruns += missed;
+        l_tickStats.lastJitter = jitter;
+        if (l_tickStats.maxJitter < jitter) {
+            l_tickStats.maxJitter = jitter;
+        }
+
+        if (missed != 0U) {
+            QS_BEGIN_NOCRIT_PRE_(QS_QF_TICK_OVERRUN, 0U)
+                QS_TIME_PRE_();       // timestamp
+                QS_U32_PRE_(missed);  // number of missed clock ticks
+                QS_U32_PRE_(jitter);  // wake-up latency [ns]
+            QS_END_NOCRIT_PRE_()
+        }
+    }
+    QF_CRIT_X_();
+}
+
+#ifndef QF_TICKLESS
+//............................................................................
+// sleep until the deadline of the next clock tick and return the number of
+// clock ticks due (more than one if some ticks have been missed), NOTE07
+static std::uint32_t tickSleep(void) {
+    std::int64_t const period = tickPeriod();
+    std::int64_t const deadline = l_lastTick + period;
+    struct timespec const ts = toTimespec(deadline);
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+
+    std::int64_t const late = monotonicTime() - deadline;
+    std::uint32_t nTicks = 0U;
+    if (late >= 0) { // not woken up early (e.g., by a signal)?
+        nTicks = static_cast<std::uint32_t>(1 + (late / period));
+        l_lastTick += static_cast<std::int64_t>(nTicks)*period;
+        tickStats(late, nTicks);
+    }
+    return nTicks;
+}
+
+#else // QF_TICKLESS
+//............................................................................
+void QF_tickWakeup_(void) {
+    pthread_mutex_lock(&l_tickMutex);
+    l_tickWakeup = true;
+    pthread_cond_signal(&l_tickCond);
+    pthread_mutex_unlock(&l_tickMutex);
+}
+//............................................................................
+// sleep until the nearest time event expires (or until a time event is
+// armed) and return the number of clock ticks elapsed since the last tick
+static QTimeEvtCtr ticklessSleep(void) {
+    std::int64_t const period = tickPeriod();
+
+    pthread_mutex_lock(&l_tickMutex);
+    QTimeEvtCtr next = 0U; // ticks until the nearest expiry (0 == none)
+    for (std::uint_fast8_t rate = 0U; rate < QF_MAX_TICK_RATE; ++rate) {
+        QTimeEvtCtr const n = QF::nextExpiryX(rate);
+        if ((n != 0U) && ((next == 0U) || (n < next))) {
+            next = n;
+        }
+    }
+    std::int64_t deadline = -1; // no deadline
+    if ((!l_tickWakeup) && l_isRunning) {
+        if (next == 0U) { // no time events armed?
+            pthread_cond_wait(&l_tickCond, &l_tickMutex);
+        }
+        else {
+            std::int64_t const t = l_lastTick
+                                   + static_cast<std::int64_t>(next)*period;
+            struct timespec const ts = toTimespec(t);
+            if (pthread_cond_timedwait(&l_tickCond, &l_tickMutex, &ts)
+                == ETIMEDOUT)
+            {
+                deadline = t;
+            }
+        }
+    }
+    l_tickWakeup = false;
+    pthread_mutex_unlock(&l_tickMutex);
+
+    // count the whole clock ticks elapsed since the last tick
+    std::int64_t const now = monotonicTime();
+    std::int64_t const elapsed = (now - l_lastTick) / period;
+    l_lastTick += elapsed*period;
+    tickStats((deadline >= 0) ? (now - deadline) : -1,
+              static_cast<std::uint32_t>(elapsed));
+    return static_cast<QTimeEvtCtr>(elapsed);
+}
+#endif // QF_TICKLESS
+
 //============================================================================
 static void sigIntHandler(int /* dummy */) {
     QF::onCleanup();
@@ -353,4 +611,33 @@ static void sigIntHandler(int /* dummy */) {
 // deliver only 2*actual-system-tick granularity. To compensate for this,
 // you would need to reduce the constant NANOSLEEP_NSEC_PER_SEC by factor 2.
 //
-
+// NOTE06:
+// By default, QF::run() executes all active objects in the single thread,
+// exactly as the QV kernel. QF_setWorkers() called before QF::run() selects
+// the number of worker threads (0 means one worker per CPU core), which
+// then share the event-loop (M:N execution of AOs on a fixed thread pool).
+// Any idle worker takes the highest-priority AO from QV_readySet_, so the
+// AOs are still selected by priority. The taken AO is moved to QV_busySet_
+// for the duration of its RTC step and QACTIVE_EQUEUE_SIGNAL_() does not
+// make a busy AO ready again, so an AO executes on only one worker at a
+// time and the run-to-completion semantics is preserved. After the RTC
+// step the worker makes the AO ready again if its queue is still not empty.
+// QF::stop() sets the stop flag of the workers in the critical section and
+// wakes up all idle workers, which then terminate (the busy workers finish
+// their RTC steps first).
+//
+// NOTE: with multiple workers, different active objects execute truly
+// concurrently, so they must not share data (other than through events),
+// just as in the multithreaded POSIX port.
+//
+// NOTE07:
+// The clock ticks are timed with absolute deadlines of the CLOCK_MONOTONIC
+// clock (clock_nanosleep() with TIMER_ABSTIME), which advance by exactly one
+// tick period regardless of the time spent in QF_onClockTick() and of the
+// scheduling latency, so the clock tick does not drift. When the ticker
+// thread wakes up late by one or more whole tick periods, it catches up by
+// calling QF_onClockTick() once for every missed tick. The number of ticks,
+// the missed ticks ("overruns") and the wake-up latency past the deadline
+// ("jitter") are available through QF_getTickStats(). Every wake-up with
+// missed ticks also produces the QS_QF_TICK_OVERRUN trace record.
+//
@@ -43,8 +43,10 @@
 // QF_OS_OBJECT_TYPE  not used
 // QF_THREAD_TYPE     not used
 
-// The maximum number of active objects in the application
-#define QF_MAX_ACTIVE        64U
+// The maximum number of active objects in the application (1..255)
+#ifndef QF_MAX_ACTIVE
+    #define QF_MAX_ACTIVE        64U
+#endif
 
 // The number of system clock tick rates
 #define QF_MAX_TICK_RATE     2U
@@ -64,7 +66,7 @@
 #define QF_CRIT_ENTRY(dummy) QP::QF_enterCriticalSection_()
 #define QF_CRIT_EXIT(dummy)  QP::QF_leaveCriticalSection_()
 
-// QF_LOG2 not defined -- use the internal LOG2() implementation
+// QF_LOG2 not defined -- QPSet uses the GCC/Clang builtins (see qpset.hpp)
 
 #include "qep_port.hpp"  // QEP port
 #include "qequeue.hpp"   // POSIX-QV needs event-queue
@@ -81,9 +83,28 @@ void QF_leaveCriticalSection_(void);
 // (NOTE: ticksPerSec==0 disables the "ticker thread"
 void QF_setTickRate(uint32_t ticksPerSec, int_t tickPrio);
 
+// set the number of worker threads executing the active objects
+// (NOTE: must be called before QF::run(); 0 means one worker per CPU core)
+void QF_setWorkers(std::uint_fast8_t nWorkers);
+
 // clock tick callback (NOTE not called when "ticker thread" is not running)
 void QF_onClockTick(void);
 
+// number of clock ticks to process in the current QF_onClockTick() call
+// (always 1, except in the "tickless" mode, see NOTE2)
+QTimeEvtCtr QF_clockTicks(void);
+
+//! statistics of the clock tick (see QF_getTickStats())
+struct QF_TickStats {
+    std::uint32_t nTicks;     //!< clock ticks processed
+    std::uint32_t nOverruns;  //!< ticks processed late (missed deadlines)
+    std::uint32_t lastJitter; //!< last wake-up latency past deadline [ns]
+    std::uint32_t maxJitter;  //!< maximum wake-up latency [ns]
+};
+
+// obtain (and optionally reset) the clock tick statistics
+void QF_getTickStats(QF_TickStats * const stats, bool const reset);
+
 // abstractions for console access...
 void QF_consoleSetup(void);
 void QF_consoleCleanup(void);
@@ -107,8 +128,10 @@ int  QF_consoleWaitForKey(void);
         Q_ASSERT((me_)->m_eQueue.m_frontEvt != nullptr)
 
     #define QACTIVE_EQUEUE_SIGNAL_(me_) do { \
-        QV_readySet_.insert((me_)->m_prio); \
-        pthread_cond_signal(&QV_condVar_); \
+        if (!QV_busySet_.hasElement((me_)->m_prio)) { \
+            QV_readySet_.insert((me_)->m_prio); \
+            pthread_cond_signal(&QV_condVar_); \
+        } \
     } while (false)
 
     // event pool operations...
@@ -124,9 +147,17 @@ int  QF_consoleWaitForKey(void);
 
     namespace QP {
         extern QPSet QV_readySet_; // QV-ready set of active objects
+        extern QPSet QV_busySet_;  // AOs executing RTC steps in workers
         extern pthread_cond_t QV_condVar_; // Cond.var. to signal events
     } // namespace QP
 
+#ifdef QF_TICKLESS // "tickless" ticker thread, see NOTE2
+    namespace QP {
+        void QF_tickWakeup_(void); // wake up the sleeping ticker thread
+    } // namespace QP
+    #define QF_TIMEEVT_ARMED_(tickRate_) QF_tickWakeup_()
+#endif // QF_TICKLESS
+
 #endif // QP_IMPL
 
 // NOTES: ====================================================================
@@ -159,6 +190,21 @@ int  QF_consoleWaitForKey(void);
 // implementation, such as POSIX threads, should support the priority-
 // inheritance protocol.
 //
+// NOTE2:
+// Defining the macro QF_TICKLESS makes the "ticker thread" sleep until the
+// nearest time event expires (QF::nextExpiryX() over all tick rates)
+// instead of waking up at every clock tick, so an idle application does not
+// wake up at all. Arming or rearming a time event wakes up the ticker thread
+// to recalculate the deadline. Every QF_onClockTick() then stands for
+// QF_clockTicks() elapsed clock ticks, which the application must process
+// with the TICKN_X() macro, e.g.:
+//     QF::TICKN_X(0U, QF_clockTicks(), &l_clock_tick);
+// (the same code works without QF_TICKLESS, where QF_clockTicks() is 1).
+// Because QF_onClockTick() is called only when some time event expires,
+// it should not be used for polling (e.g., of the console) in this mode.
+// The time events of all tick rates are assumed to be serviced at the
+// base rate or slower.
+//
 
 #endif // QF_PORT_HPP
 
@@ -57,6 +57,8 @@
 #include <string.h>         // for memcpy() and memset()
 #include <stdlib.h>
 #include <stdio.h>
+#include <errno.h>          // for ETIMEDOUT
+#include <time.h>           // for clock_nanosleep()
 #include <termios.h>
 #include <unistd.h>
 #include <signal.h>
@@ -68,14 +70,45 @@ Q_DEFINE_THIS_MODULE("qf_port")
 /* Global objects ==========================================================*/
 pthread_mutex_t QF_pThreadMutex_; // mutex for QF critical section
 
+#ifdef QF_FINE_LOCKS_
+pthread_mutex_t QF_poolMutex_[QF_LOCK_STRIPES]; // event pools
+pthread_mutex_t QF_evtMutex_[QF_LOCK_STRIPES];  // event ref. counters
+pthread_mutex_t QF_psMutex_;  // subscriber lists
+pthread_mutex_t QF_timeEvtMutex_[QF_MAX_TICK_RATE]; // time events
+#endif
+// producers blocked in QF_postBlocking() per recipient AO
+std::uint32_t volatile QF_postWaiters_[QF_MAX_ACTIVE + 1U];
+
 // Local objects *************************************************************
 static pthread_mutex_t l_startupMutex;
 static bool l_isRunning;      // flag indicating when QF is running
 static struct termios l_tsav; // structure with saved terminal attributes
 static struct timespec l_tick;
 static int_t l_tickPrio;
+static QTimeEvtCtr l_clockTicks = 1U; // ticks for the QF_onClockTick() call
+static std::int64_t l_lastTick;       // time of the last clock tick [ns]
+static QF_TickStats l_tickStats;      // clock tick statistics, see NOTE06
+// the blocking posts per recipient AO, see NOTE5 in qf_port.hpp
+static struct {
+    pthread_mutex_t mutex; // mutex of the blocking posts to the AO
+    pthread_cond_t  cond;  // cond. var. of the free entries in the AO queue
+    QF_PostStats stats;    // statistics of the blocking posts to the AO
+} l_post[QF_MAX_ACTIVE + 1U];
 enum { NANOSLEEP_NSEC_PER_SEC = 1000000000 }; // see NOTE05
 
+#ifdef QF_TICKLESS
+static pthread_mutex_t l_tickMutex; // mutex protecting the tickless sleep
+static pthread_cond_t  l_tickCond;  // cond. var. to wake up the clock loop
+static bool l_tickWakeup;           // time event armed during the sleep
+
+static QTimeEvtCtr ticklessSleep(void);
+#else
+static std::uint32_t tickSleep(void);
+#endif // QF_TICKLESS
+
+static std::int64_t monotonicTime(void);
+static struct timespec toTimespec(std::int64_t const t);
+
 static void sigIntHandler(int /* dummy */);
 static void *ao_thread(void *arg); // thread routine for all AOs
 
@@ -87,9 +120,41 @@ void QF::init(void) {
     // init the global mutex with the default non-recursive initializer
     pthread_mutex_init(&QF_pThreadMutex_, NULL);
 
+#ifdef QF_FINE_LOCKS_
+    // init the mutexes of the fine-grained locking
+    for (std::uint_fast8_t i = 0U; i < QF_LOCK_STRIPES; ++i) {
+        pthread_mutex_init(&QF_poolMutex_[i], NULL);
+        pthread_mutex_init(&QF_evtMutex_[i], NULL);
+    }
+    pthread_mutex_init(&QF_psMutex_, NULL);
+    for (std::uint_fast8_t i = 0U; i < QF_MAX_TICK_RATE; ++i) {
+        pthread_mutex_init(&QF_timeEvtMutex_[i], NULL);
+    }
+#endif // QF_FINE_LOCKS_
+
     // init the startup mutex with the default non-recursive initializer
     pthread_mutex_init(&l_startupMutex, NULL);
 
+    // init the blocking posts, which time out on the CLOCK_MONOTONIC clock
+    pthread_condattr_t postCondAttr;
+    pthread_condattr_init(&postCondAttr);
+    pthread_condattr_setclock(&postCondAttr, CLOCK_MONOTONIC);
+    for (std::uint_fast16_t p = 0U; p <= QF_MAX_ACTIVE; ++p) {
+        pthread_mutex_init(&l_post[p].mutex, NULL);
+        pthread_cond_init(&l_post[p].cond, &postCondAttr);
+    }
+    pthread_condattr_destroy(&postCondAttr);
+
+#ifdef QF_TICKLESS
+    // init the tickless sleep, which measures time with CLOCK_MONOTONIC
+    pthread_mutex_init(&l_tickMutex, NULL);
+    pthread_condattr_t condAttr;
+    pthread_condattr_init(&condAttr);
+    pthread_condattr_setclock(&condAttr, CLOCK_MONOTONIC);
+    pthread_cond_init(&l_tickCond, &condAttr);
+    pthread_condattr_destroy(&condAttr);
+#endif // QF_TICKLESS
+
     // lock the startup mutex to block any active objects started before
     // calling QF::run()
     pthread_mutex_lock(&l_startupMutex);
@@ -137,14 +202,41 @@ int_t QF::run(void) {
     pthread_mutex_unlock(&l_startupMutex);
 
     l_isRunning = true;
+    l_lastTick = monotonicTime();
+#ifndef QF_TICKLESS
     while (l_isRunning) { // the clock tick loop...
-        QF_onClockTick(); // clock tick callback (must call QF_TICK_X())
-
-        nanosleep(&l_tick, NULL); // sleep for the number of ticks, NOTE05
+        // call the clock tick callback for every due tick, see NOTE06
+        for (std::uint32_t n = tickSleep(); (n != 0U) && l_isRunning; --n) {
+            QF_onClockTick(); // clock tick callback (must call QF_TICK_X())
+        }
     }
+#else
+    while (l_isRunning) { // the tickless clock loop, see NOTE4
+        l_clockTicks = ticklessSleep();
+        if (l_clockTicks != 0U) {
+            QF_onClockTick(); // clock tick callback (must call TICKN_X())
+        }
+    }
+    pthread_cond_destroy(&l_tickCond);
+    pthread_mutex_destroy(&l_tickMutex);
+#endif // QF_TICKLESS
     onCleanup(); // cleanup callback
     pthread_mutex_destroy(&l_startupMutex);
+    for (std::uint_fast16_t p = 0U; p <= QF_MAX_ACTIVE; ++p) {
+        pthread_cond_destroy(&l_post[p].cond);
+        pthread_mutex_destroy(&l_post[p].mutex);
+    }
     pthread_mutex_destroy(&QF_pThreadMutex_);
+#ifdef QF_FINE_LOCKS_
+    for (std::uint_fast8_t i = 0U; i < QF_LOCK_STRIPES; ++i) {
+        pthread_mutex_destroy(&QF_poolMutex_[i]);
+        pthread_mutex_destroy(&QF_evtMutex_[i]);
+    }
+    pthread_mutex_destroy(&QF_psMutex_);
+    for (std::uint_fast8_t i = 0U; i < QF_MAX_TICK_RATE; ++i) {
+        pthread_mutex_destroy(&QF_timeEvtMutex_[i]);
+    }
+#endif // QF_FINE_LOCKS_
 
     return 0; // return success
 }
@@ -154,10 +246,250 @@ void QF_setTickRate(std::uint32_t ticksPerSec, int_t tickPrio) {
     l_tick.tv_nsec = NANOSLEEP_NSEC_PER_SEC / ticksPerSec;
     l_tickPrio = tickPrio;
 }
+//............................................................................
+QTimeEvtCtr QF_clockTicks(void) {
+    return l_clockTicks;
+}
+//............................................................................
+void QF_getTickStats(QF_TickStats * const stats, bool const reset) {
+    QF_CRIT_STAT_
+    QF_CRIT_E_();
+    *stats = l_tickStats;
+    if (reset) {
+        memset(&l_tickStats, 0, sizeof(l_tickStats));
+    }
+    QF_CRIT_X_();
+}
+
+//============================================================================
+// blocking post with backpressure, see NOTE5 in qf_port.hpp
+//............................................................................
+bool QF_postBlocking(QActive * const act, QEvt const * const e,
+                     std::uint32_t const timeout_ms,
+                     void const * const sender)
+{
+    //! @pre the recipient AO and the event must be valid
+    Q_REQUIRE_ID(700, (act != nullptr) && (e != nullptr));
+
+    std::uint_fast8_t const prio =
+        static_cast<std::uint_fast8_t>(act->getPrio());
+    static_cast<void>(sender); // unused without QS
+
+    // hold an extra reference to a dynamic event, so that the failed
+    // attempts to post do not recycle it
+    if (e->poolId_ != 0U) {
+        QF_CRIT_STAT_
+        QF_EVT_CRIT_E_(e);
+        QF_EVT_REF_CTR_INC_(e);
+        QF_EVT_CRIT_X_(e);
+    }
+
+    bool posted = act->POST_X(e, 0U, sender);
+    std::int64_t blocked = -1; // time blocked [ns] (negative: not blocked)
+    if (!posted) { // the queue is full?
+        std::int64_t const t0 = monotonicTime();
+        struct timespec const deadline = toTimespec(
+            t0 + static_cast<std::int64_t>(timeout_ms)
+                 *(NANOSLEEP_NSEC_PER_SEC/1000));
+
+        pthread_mutex_lock(&l_post[prio].mutex);
+        __atomic_fetch_add(&QF_postWaiters_[prio], 1U, __ATOMIC_SEQ_CST);
+        int err = 0;
+        while ((!posted) && (err != ETIMEDOUT)) {
+            // check the queue only after announcing the waiter
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            if (act->m_eQueue.getNFree() == 0U) {
+                err = pthread_cond_timedwait(&l_post[prio].cond,
+                                             &l_post[prio].mutex, &deadline);
+            }
+            else { // a free entry available, try to post again
+                pthread_mutex_unlock(&l_post[prio].mutex);
+                posted = act->POST_X(e, 0U, sender);
+                pthread_mutex_lock(&l_post[prio].mutex);
+            }
+        }
+        __atomic_fetch_sub(&QF_postWaiters_[prio], 1U, __ATOMIC_SEQ_CST);
+        if ((!posted) && (act->m_eQueue.getNFree() != 0U)) {
+            // timed out with a wake-up pending, pass it on to another waiter
+            pthread_cond_signal(&l_post[prio].cond);
+        }
+        pthread_mutex_unlock(&l_post[prio].mutex);
+
+        blocked = monotonicTime() - t0;
+    }
+
+    // update the statistics of the recipient AO
+    pthread_mutex_lock(&l_post[prio].mutex);
+    QF_PostStats * const stats = &l_post[prio].stats;
+    ++stats->nPosts;
+    if (blocked >= 0) {
+        ++stats->nBlocked;
+        stats->blockedTime += static_cast<std::uint64_t>(blocked);
+        if (stats->maxBlocked < static_cast<std::uint64_t>(blocked)) {
+            stats->maxBlocked = static_cast<std::uint64_t>(blocked);
+        }
+        if (!posted) {
+            ++stats->nTimeouts;
+        }
+    }
+    pthread_mutex_unlock(&l_post[prio].mutex);
+
+    QF::gc(e); // drop the extra reference (recycles the event if not posted)
+    return posted;
+}
+//............................................................................
+void QF_postWakeup_(std::uint_fast8_t const prio) {
+    pthread_mutex_lock(&l_post[prio].mutex);
+    pthread_cond_signal(&l_post[prio].cond); // one entry freed, one waiter
+    pthread_mutex_unlock(&l_post[prio].mutex);
+}
+//............................................................................
+void QF_getPostStats(std::uint_fast8_t const prio,
+                     QF_PostStats * const stats, bool const reset)
+{
+    //! @pre the priority must be in range
+    Q_REQUIRE_ID(800, prio <= QF_MAX_ACTIVE);
+
+    pthread_mutex_lock(&l_post[prio].mutex);
+    *stats = l_post[prio].stats;
+    if (reset) {
+        memset(&l_post[prio].stats, 0, sizeof(l_post[prio].stats));
+    }
+    pthread_mutex_unlock(&l_post[prio].mutex);
+}
+
 //............................................................................
 void QF::stop(void) {
     l_isRunning = false; // stop the loop in QF::run()
+#ifdef QF_TICKLESS
+    QF_tickWakeup_();
+#endif
+}
+
+//============================================================================
+// clock tick helpers
+//............................................................................
+// the current time of the CLOCK_MONOTONIC clock [ns]
+static std::int64_t monotonicTime(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<std::int64_t>(now.tv_sec)*NANOSLEEP_NSEC_PER_SEC
+           + now.tv_nsec;
+}
+//............................................................................
+// the period of the clock tick [ns]
+static std::int64_t tickPeriod(void) {
+    return static_cast<std::int64_t>(l_tick.tv_sec)*NANOSLEEP_NSEC_PER_SEC
+           + l_tick.tv_nsec;
+}
+//............................................................................
+// convert the CLOCK_MONOTONIC time @p t [ns] to struct timespec
+static struct timespec toTimespec(std::int64_t const t) {
+    struct timespec ts;
+    ts.tv_sec  = static_cast<time_t>(t / NANOSLEEP_NSEC_PER_SEC);
+    ts.tv_nsec = static_cast<long>(t % NANOSLEEP_NSEC_PER_SEC);
+    return ts;
+}
+//............................................................................
+// account for @p nTicks clock ticks processed after waking up @p late [ns]
+// past the deadline (negative @p late means no deadline), see NOTE06
+static void tickStats(std::int64_t const late, std::uint32_t const nTicks) {
+    QF_CRIT_STAT_
+    QF_CRIT_E_();
+    l_tickStats.nTicks += nTicks;
+    if (late >= 0) {
+        std::uint32_t const missed =
+            static_cast<std::uint32_t>(late / tickPeriod());
+        std::uint32_t const jitter = (late < 0xFFFFFFFF)
+            ? static_cast<std::uint32_t>(late)
+            : 0xFFFFFFFFU;
+        l_tickStats.nOverruns += missed;
+        l_tickStats.lastJitter = jitter;
+        if (l_tickStats.maxJitter < jitter) {
+            l_tickStats.maxJitter = jitter;
+        }
+
+        if (missed != 0U) {
+            QS_BEGIN_NOCRIT_PRE_(QS_QF_TICK_OVERRUN, 0U)
+                QS_TIME_PRE_();       // timestamp
+                QS_U32_PRE_(missed);  // number of missed clock ticks
+                QS_U32_PRE_(jitter);  // wake-up latency [ns]
+            QS_END_NOCRIT_PRE_()
+        }
+    }
+    QF_CRIT_X_();
+}
+
+#ifndef QF_TICKLESS
+//............................................................................
+// sleep until the deadline of the next clock tick and return the number of
+// clock ticks due (more than one if some ticks have been missed), NOTE06
+static std::uint32_t tickSleep(void) {
+    std::int64_t const period = tickPeriod();
+    std::int64_t const deadline = l_lastTick + period;
+    struct timespec const ts = toTimespec(deadline);
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+
+    std::int64_t const late = monotonicTime() - deadline;
+    std::uint32_t nTicks = 0U;
+    if (late >= 0) { // not woken up early (e.g., by a signal)?
+        nTicks = static_cast<std::uint32_t>(1 + (late / period));
+        l_lastTick += static_cast<std::int64_t>(nTicks)*period;
+        tickStats(late, nTicks);
+    }
+    return nTicks;
+}
+
+#else // QF_TICKLESS
+//............................................................................
+void QF_tickWakeup_(void) {
+    pthread_mutex_lock(&l_tickMutex);
+    l_tickWakeup = true;
+    pthread_cond_signal(&l_tickCond);
+    pthread_mutex_unlock(&l_tickMutex);
+}
+//............................................................................
+// sleep until the nearest time event expires (or until a time event is
+// armed) and return the number of clock ticks elapsed since the last tick
+static QTimeEvtCtr ticklessSleep(void) {
+    std::int64_t const period = tickPeriod();
+
+    pthread_mutex_lock(&l_tickMutex);
+    QTimeEvtCtr next = 0U; // ticks until the nearest expiry (0 == none)
+    for (std::uint_fast8_t rate = 0U; rate < QF_MAX_TICK_RATE; ++rate) {
+        QTimeEvtCtr const n = QF::nextExpiryX(rate);
+        if ((n != 0U) && ((next == 0U) || (n < next))) {
+            next = n;
+        }
+    }
+    std::int64_t deadline = -1; // no deadline
+    if ((!l_tickWakeup) && l_isRunning) {
+        if (next == 0U) { // no time events armed?
+            pthread_cond_wait(&l_tickCond, &l_tickMutex);
+        }
+        else {
+            std::int64_t const t = l_lastTick
+                                   + static_cast<std::int64_t>(next)*period;
+            struct timespec const ts = toTimespec(t);
+            if (pthread_cond_timedwait(&l_tickCond, &l_tickMutex, &ts)
+                == ETIMEDOUT)
+            {
+                deadline = t;
+            }
+        }
+    }
+    l_tickWakeup = false;
+    pthread_mutex_unlock(&l_tickMutex);
+
+    // count the whole clock ticks elapsed since the last tick
+    std::int64_t const now = monotonicTime();
+    std::int64_t const elapsed = (now - l_lastTick) / period;
+    l_lastTick += elapsed*period;
+    tickStats((deadline >= 0) ? (now - deadline) : -1,
+              static_cast<std::uint32_t>(elapsed));
+    return static_cast<QTimeEvtCtr>(elapsed);
 }
+#endif // QF_TICKLESS
 //............................................................................
 void QF::thread_(QActive *act) {
     // block this thread until the startup mutex is unlocked from QF::run()
@@ -218,9 +550,25 @@ void QActive::start(std::uint_fast8_t const prio,
     // p-threads allocate stack internally
     Q_REQUIRE_ID(600, stkSto == nullptr);
 
+#if (defined QF_EQUEUE_LOCKFREE)
+    sem_init(&m_osObject, 0, 0U);
+#elif (defined QF_FINE_LOCKS_)
+    pthread_mutex_init(&m_osObject.mutex, NULL);
+    pthread_cond_init(&m_osObject.cond, 0);
+#else
     pthread_cond_init(&m_osObject, 0);
+#endif
 
     m_eQueue.init(qSto, qLen);
+#ifdef QF_EQUEUE_LOCKFREE
+    // the lock-free queue keeps all events in the ring buffer, see NOTE3
+    // in qf_port.hpp, where the empty entries must hold nullptr
+    for (std::uint_fast16_t i = 0U; i < qLen; ++i) {
+        qSto[i] = nullptr;
+    }
+    m_eQueue.m_nFree = static_cast<QEQueueCtr>(qLen);
+    m_eQueue.m_nMin  = static_cast<QEQueueCtr>(qLen);
+#endif
     m_prio = static_cast<std::uint8_t>(prio); // set the QF prio of this AO
     QF::add_(this); // make QF aware of this AO
 
@@ -238,9 +586,17 @@ void QActive::start(std::uint_fast8_t const prio,
 
     // priority of the p-thread, see NOTE04
     struct sched_param param;
-    param.sched_priority = prio
-                           + (sched_get_priority_max(SCHED_FIFO)
-                              - QF_MAX_ACTIVE - 3U);
+    int const maxSched = sched_get_priority_max(SCHED_FIFO) - 3;
+    int const nSched = maxSched - sched_get_priority_min(SCHED_FIFO);
+    if (static_cast<int>(QF_MAX_ACTIVE) <= nSched) {
+        param.sched_priority = static_cast<int>(prio)
+                               + (maxSched - static_cast<int>(QF_MAX_ACTIVE));
+    }
+    else { // more QF priorities than p-thread priorities
+        param.sched_priority = maxSched
+            - (((static_cast<int>(QF_MAX_ACTIVE) - static_cast<int>(prio))
+                * nSched) / static_cast<int>(QF_MAX_ACTIVE));
+    }
     pthread_attr_setschedparam(&attr, &param);
 
     pthread_attr_setstacksize(&attr, (stkSize < PTHREAD_STACK_MIN
@@ -324,9 +680,24 @@ static void sigIntHandler(int /* dummy */) {
 // three highest p-thread priorities for the ISR-like threads (e.g., I/O),
 // and the rest highest-priorities for the active objects.
 //
+// When QF_MAX_ACTIVE exceeds the available SCHED_FIFO range (e.g., several
+// hundred AOs, with the QP::QPSet switching to the hierarchical variant),
+// the QF priorities are scaled down to the p-thread priorities. Several
+// AOs then share the same p-thread priority, but the order is preserved.
+//
 // NOTE05:
 // In some (older) Linux kernels, the POSIX nanosleep() system call might
 // deliver only 2*actual-system-tick granularity. To compensate for this,
 // you would need to reduce the constant NANOSLEEP_NSEC_PER_SEC by factor 2.
 //
-
+// NOTE06:
+// The clock ticks are timed with absolute deadlines of the CLOCK_MONOTONIC
+// clock (clock_nanosleep() with TIMER_ABSTIME), which advance by exactly one
+// tick period regardless of the time spent in QF_onClockTick() and of the
+// scheduling latency, so the clock tick does not drift. When the ticker
+// wakes up late by one or more whole tick periods, it catches up by calling
+// QF_onClockTick() once for every missed tick. The number of ticks, the
+// missed ticks ("overruns") and the wake-up latency past the deadline
+// ("jitter") are available through QF_getTickStats(). Every wake-up with
+// missed ticks also produces the QS_QF_TICK_OVERRUN trace record.
+//
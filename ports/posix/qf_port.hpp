@@ -38,13 +38,27 @@
 #ifndef QF_PORT_HPP
 #define QF_PORT_HPP
 
+// fine-grained locking for multi-core hosts (opt-in), see NOTE2
+// NOTE: the QS software tracing requires the single QF critical section
+#if (defined QF_FINE_LOCKS) && (!defined Q_SPY)
+    #define QF_FINE_LOCKS_    1
+#endif
+
 // event queue and thread types
 #define QF_EQUEUE_TYPE        QEQueue
-#define QF_OS_OBJECT_TYPE     pthread_cond_t
+#ifdef QF_EQUEUE_LOCKFREE  // lock-free event queues (opt-in), see NOTE3
+    #define QF_OS_OBJECT_TYPE sem_t
+#elif (defined QF_FINE_LOCKS_)
+    #define QF_OS_OBJECT_TYPE QF_AOSync
+#else
+    #define QF_OS_OBJECT_TYPE pthread_cond_t
+#endif
 #define QF_THREAD_TYPE        bool
 
-// The maximum number of active objects in the application
-#define QF_MAX_ACTIVE         64U
+// The maximum number of active objects in the application (1..255)
+#ifndef QF_MAX_ACTIVE
+    #define QF_MAX_ACTIVE         64U
+#endif
 
 // The number of system clock tick rates
 #define QF_MAX_TICK_RATE      2U
@@ -65,6 +79,23 @@
 #define QF_CRIT_EXIT(dummy)  QP::QF_leaveCriticalSection_()
 
 #include <pthread.h>   // POSIX-thread API
+#ifdef QF_EQUEUE_LOCKFREE
+#include <semaphore.h> // POSIX semaphores
+#include <sched.h>     // for sched_yield()
+#endif
+
+#if (defined QF_FINE_LOCKS_) && (!defined QF_EQUEUE_LOCKFREE)
+namespace QP {
+
+//! synchronization object of an active object for fine-grained locking
+struct QF_AOSync {
+    pthread_mutex_t mutex; //!< mutex protecting the AO's event queue
+    pthread_cond_t  cond;  //!< condition variable signaling a new event
+};
+
+} // namespace QP
+#endif // QF_FINE_LOCKS_
+
 #include "qep_port.hpp"  // QEP port
 #include "qequeue.hpp"   // POSIX needs event-queue
 #include "qmpool.hpp"    // POSIX needs memory-pool
@@ -82,6 +113,41 @@ void QF_setTickRate(uint32_t ticksPerSec, int_t tickPrio);
 // clock tick callback (provided in the app)
 void QF_onClockTick(void);
 
+// number of clock ticks to process in the current QF_onClockTick() call
+// (always 1, except in the "tickless" mode, see NOTE4)
+QTimeEvtCtr QF_clockTicks(void);
+
+//! statistics of the clock tick (see QF_getTickStats())
+struct QF_TickStats {
+    std::uint32_t nTicks;     //!< clock ticks processed
+    std::uint32_t nOverruns;  //!< ticks processed late (missed deadlines)
+    std::uint32_t lastJitter; //!< last wake-up latency past deadline [ns]
+    std::uint32_t maxJitter;  //!< maximum wake-up latency [ns]
+};
+
+// obtain (and optionally reset) the clock tick statistics
+void QF_getTickStats(QF_TickStats * const stats, bool const reset);
+
+// post an event to an AO, blocking up to timeout_ms [ms] while the AO's
+// event queue is full, see NOTE5
+bool QF_postBlocking(QActive * const act, QEvt const * const e,
+                     std::uint32_t const timeout_ms,
+                     void const * const sender);
+
+//! statistics of the blocking posts to one AO (see QF_getPostStats())
+struct QF_PostStats {
+    std::uint32_t nPosts;     //!< posts through QF_postBlocking()
+    std::uint32_t nBlocked;   //!< posts that waited for a free queue entry
+    std::uint32_t nTimeouts;  //!< posts that timed out (event not posted)
+    std::uint64_t blockedTime; //!< total time blocked [ns]
+    std::uint64_t maxBlocked; //!< longest time blocked in one post [ns]
+};
+
+// obtain (and optionally reset) the statistics of the blocking posts
+// to the AO of priority prio
+void QF_getPostStats(std::uint_fast8_t const prio,
+                     QF_PostStats * const stats, bool const reset);
+
 // abstractions for console access...
 void QF_consoleSetup(void);
 void QF_consoleCleanup(void);
@@ -90,6 +156,32 @@ int  QF_consoleWaitForKey(void);
 
 extern pthread_mutex_t QF_pThreadMutex_; // mutex for QF critical section
 
+#ifdef QF_FINE_LOCKS_
+
+// number of mutexes protecting the event pools and event reference counters
+#define QF_LOCK_STRIPES       16U
+
+extern pthread_mutex_t QF_poolMutex_[QF_LOCK_STRIPES]; // event pools
+extern pthread_mutex_t QF_evtMutex_[QF_LOCK_STRIPES];  // event ref. counters
+extern pthread_mutex_t QF_psMutex_;  // subscriber lists
+extern pthread_mutex_t QF_timeEvtMutex_[QF_MAX_TICK_RATE]; // time events
+
+//! the mutex stripe protecting the memory pool @p pool
+inline std::uint_fast8_t QF_poolStripe_(void const * const pool) noexcept {
+    return static_cast<std::uint_fast8_t>(
+        (reinterpret_cast<std::uintptr_t>(pool) / sizeof(QMPool))
+        % QF_LOCK_STRIPES);
+}
+
+//! the mutex stripe protecting the reference counter of the event @p e
+inline std::uint_fast8_t QF_evtStripe_(void const * const e) noexcept {
+    std::uintptr_t const a = reinterpret_cast<std::uintptr_t>(e);
+    return static_cast<std::uint_fast8_t>(
+        ((a >> 4U) ^ (a >> 8U)) % QF_LOCK_STRIPES);
+}
+
+#endif // QF_FINE_LOCKS_
+
 } // namespace QP
 
 //============================================================================
@@ -102,6 +194,20 @@ extern pthread_mutex_t QF_pThreadMutex_; // mutex for QF critical section
     #define QF_SCHED_LOCK_(dummy) ((void)0)
     #define QF_SCHED_UNLOCK_()    ((void)0)
 
+#ifdef QF_EQUEUE_LOCKFREE // lock-free event queues, see NOTE3
+
+    // native event queue operations (outside critical section)...
+    #define QACTIVE_EQUEUE_WAIT_(me_) \
+        while (sem_wait(&(me_)->m_osObject) != 0) {}
+
+    #define QACTIVE_EQUEUE_SIGNAL_(me_) \
+        Q_ASSERT_ID(410, QF::active_[(me_)->m_prio] != nullptr); \
+        sem_post(&(me_)->m_osObject)
+
+    #define QF_EQUEUE_LF_RELAX_() sched_yield()
+
+#elif (!defined QF_FINE_LOCKS_)
+
     // native event queue operations...
     #define QACTIVE_EQUEUE_WAIT_(me_) \
         while ((me_)->m_eQueue.m_frontEvt == nullptr) \
@@ -111,6 +217,79 @@ extern pthread_mutex_t QF_pThreadMutex_; // mutex for QF critical section
         Q_ASSERT_ID(410, QF::active_[(me_)->m_prio] != nullptr); \
         pthread_cond_signal(&(me_)->m_osObject) \
 
+#else // fine-grained locking, see NOTE2
+
+    // native event queue operations...
+    #define QACTIVE_EQUEUE_WAIT_(me_) \
+        while ((me_)->m_eQueue.m_frontEvt == nullptr) \
+            pthread_cond_wait(&(me_)->m_osObject.cond, \
+                              &(me_)->m_osObject.mutex)
+
+    #define QACTIVE_EQUEUE_SIGNAL_(me_) \
+        Q_ASSERT_ID(410, QF::active_[(me_)->m_prio] != nullptr); \
+        pthread_cond_signal(&(me_)->m_osObject.cond) \
+
+    // critical sections of the AO event queues...
+    #define QACTIVE_EQUEUE_CRIT_E_(me_) \
+        pthread_mutex_lock(&(me_)->m_osObject.mutex)
+    #define QACTIVE_EQUEUE_CRIT_X_(me_) \
+        pthread_mutex_unlock(&(me_)->m_osObject.mutex)
+
+#endif
+
+#ifdef QF_FINE_LOCKS_
+
+    // critical sections of the other QF data structures...
+    #define QF_MPOOL_CRIT_E_(me_) \
+        pthread_mutex_lock(&QF_poolMutex_[QF_poolStripe_(me_)])
+    #define QF_MPOOL_CRIT_X_(me_) \
+        pthread_mutex_unlock(&QF_poolMutex_[QF_poolStripe_(me_)])
+
+    #define QF_PS_CRIT_E_()  pthread_mutex_lock(&QF_psMutex_)
+    #define QF_PS_CRIT_X_()  pthread_mutex_unlock(&QF_psMutex_)
+
+    #define QF_TIMEEVT_CRIT_E_(tickRate_) \
+        pthread_mutex_lock(&QF_timeEvtMutex_[(tickRate_)])
+    #define QF_TIMEEVT_CRIT_X_(tickRate_) \
+        pthread_mutex_unlock(&QF_timeEvtMutex_[(tickRate_)])
+
+#ifndef QF_EVT_REF_ATOMIC // reference counters not atomic? see NOTE2
+    #define QF_EVT_CRIT_E_(e_) \
+        pthread_mutex_lock(&QF_evtMutex_[QF_evtStripe_(e_)])
+    #define QF_EVT_CRIT_X_(e_) \
+        pthread_mutex_unlock(&QF_evtMutex_[QF_evtStripe_(e_)])
+    #define QF_EVT_REF_LOCK_(e_)   QF_EVT_CRIT_E_(e_)
+    #define QF_EVT_REF_UNLOCK_(e_) QF_EVT_CRIT_X_(e_)
+#endif
+
+#endif // QF_FINE_LOCKS_
+
+    namespace QP {
+        // producers blocked in QF_postBlocking() per recipient AO
+        extern std::uint32_t volatile QF_postWaiters_[QF_MAX_ACTIVE + 1U];
+
+        // wake up a producer blocked on the queue of the AO of prio
+        void QF_postWakeup_(std::uint_fast8_t const prio);
+
+        // a queue entry of the AO of prio has been freed, see NOTE5
+        inline void QF_postFreed_(std::uint_fast8_t const prio) noexcept {
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            if (__atomic_load_n(&QF_postWaiters_[prio], __ATOMIC_RELAXED)
+                != 0U)
+            {
+                QF_postWakeup_(prio);
+            }
+        }
+    } // namespace QP
+    #define QACTIVE_EQUEUE_FREED_(me_) QF_postFreed_((me_)->getPrio())
+
+#ifdef QF_TICKLESS // "tickless" clock, see NOTE4
+    namespace QP {
+        void QF_tickWakeup_(void); // wake up the sleeping clock loop
+    } // namespace QP
+    #define QF_TIMEEVT_ARMED_(tickRate_) QF_tickWakeup_()
+#endif // QF_TICKLESS
+
     // event pool operations...
     #define QF_EPOOL_TYPE_  QMPool
     #define QF_EPOOL_INIT_(p_, poolSto_, poolSize_, evtSize_) \
@@ -152,6 +331,75 @@ extern pthread_mutex_t QF_pThreadMutex_; // mutex for QF critical section
 // implementation, such as POSIX threads, should support the priority-
 // inheritance protocol.
 //
+// NOTE2:
+// On multi-core hosts the single QF critical section serializes all threads
+// that post, publish, allocate, or recycle events, even when they operate on
+// unrelated objects. Defining the macro QF_FINE_LOCKS (e.g., on the compiler
+// command-line) replaces the single mutex with separate mutexes:
+// - every active object protects its event queue with its own mutex,
+//   which is also used with the condition variable of the AO's thread;
+// - event pools and the reference counters of dynamic events are protected
+//   by "striped" mutexes selected by the object's address;
+// - the subscriber lists are protected by one dedicated mutex;
+// - the time events of each tick rate are protected by a dedicated mutex.
+//
+// The mutexes are always acquired in the following order: AO queue or
+// subscriber lists or time events, then event reference counters. The
+// event-pool mutexes are never held while acquiring any other mutex.
+// QF_FINE_LOCKS is ignored in the Spy build configuration, because the
+// QS trace buffer is protected only by the single QF critical section.
+// Defining also the macro QF_EVT_REF_ATOMIC (see src/qf_pkg.hpp) replaces
+// the striped mutexes of the event reference counters with atomic
+// operations, so that the lifecycle of shared events takes no mutex.
+//
+// NOTE3:
+// Defining the macro QF_EQUEUE_LOCKFREE selects the lock-free, bounded,
+// multiple-producer/single-consumer implementation of the AO event queues
+// (see QActive::post_(), QActive::postLIFO() and QActive::get_()). Posting
+// an event then takes no mutex and signals the AO thread through a POSIX
+// semaphore, which does not enter the kernel unless the AO thread waits.
+// The lock-free queue keeps all events in the ring buffer, so it can hold
+// at most qLen events (one less than the standard QEQueue). The margin
+// checks and the minimum of free entries (QF::getQueueMin()) are preserved.
+// QActive::postLIFO() must be called only from the AO's own thread (self-
+// posting). Unnamed POSIX semaphores (sem_init()) are required (Linux).
+// The option can be combined with QF_FINE_LOCKS (see NOTE2), which then
+// protects only the event pools, subscriber lists, time events, and
+// reference counters of dynamic events.
+//
+// NOTE4:
+// Defining the macro QF_TICKLESS makes the clock loop in QF::run() sleep
+// until the nearest time event expires (QF::nextExpiryX() over all tick
+// rates) instead of waking up at every clock tick. Arming or rearming a
+// time event wakes up the clock loop to recalculate the deadline. When no
+// time events are armed, the clock loop sleeps until one is armed. Every
+// QF_onClockTick() then stands for QF_clockTicks() elapsed clock ticks,
+// which the application must process with the TICKN_X() macro, e.g.:
+//     QF::TICKN_X(0U, QF_clockTicks(), &l_clock_tick);
+// (the same code works without QF_TICKLESS, where QF_clockTicks() is 1).
+// Because QF_onClockTick() is called only when some time event expires,
+// it should not be used for polling (e.g., of the console) in this mode.
+// The time events of all tick rates are assumed to be serviced at the
+// base rate or slower.
+//
+// NOTE5:
+// QF_postBlocking() gives producers outside of the active objects (e.g.,
+// I/O reader threads) flow control instead of dropped events or assertions.
+// When the event queue of the recipient AO is full, the producer blocks on
+// the condition variable of that AO until the AO frees a queue entry or
+// until the timeout expires. The timeout applies to the whole post.
+// A timed-out post recycles the event and returns 'false', like a failed
+// POST_X(). The producers wait per recipient AO, so that QActive::get_()
+// calls QF_postWakeup_() only when some producer is blocked on the queue
+// of this very AO, and then wakes up only one of them (a producer that
+// times out passes the wake-up on). The producer announces itself in
+// QF_postWaiters_[] before it checks the queue. The AO frees the entry
+// before it checks QF_postWaiters_[]. Both sides use sequentially-consistent
+// operations, so a wake-up cannot be lost. The number of blocked posts,
+// the timeouts, and the time spent blocked are accumulated per recipient AO
+// (see QF_getPostStats()). QF_postBlocking() must not be called from an
+// active object, because it could deadlock the AOs posting to each other.
+//
 
 #endif // QF_PORT_HPP
 
@@ -46,6 +46,15 @@
 #define QEP_TRIG_(state_, sig_) \
     ((*(state_))(this, &QEP_reservedEvt_[sig_]))
 
+#ifdef QHSM_STATE_TABLE
+    //! helper macro to find the superstate of a state in an HSM
+    //! (through the table of state parents, see QP::QHsmStateTable)
+    #define QEP_SUPER_(state_) (hsm_super((state_)))
+#else
+    //! helper macro to find the superstate of a state in an HSM
+    #define QEP_SUPER_(state_) QEP_TRIG_(state_, QEP_EMPTY_SIG_)
+#endif // QHSM_STATE_TABLE
+
 //! helper macro to trigger exit action in an HSM
 #define QEP_EXIT_(state_) do {                            \
     if (QEP_TRIG_(state_, Q_EXIT_SIG) == Q_RET_HANDLED) { \
@@ -116,6 +125,12 @@ namespace QP {
 QHsm::QHsm(QStateHandler const initial) noexcept {
     m_state.fun = Q_STATE_CAST(&top);
     m_temp.fun  = initial;
+#ifdef QHSM_TRAN_CACHE
+    m_tranCache = nullptr; // no memo of transition paths
+#endif
+#ifdef QHSM_STATE_TABLE
+    m_stateTable = nullptr; // no table of state parents
+#endif
 }
 
 //============================================================================
@@ -165,12 +180,12 @@ void QHsm::init(void const * const e, std::uint_fast8_t const qs_id) {
         std::int_fast8_t ip = 0; // entry path index
 
         path[0] = m_temp.fun;
-        static_cast<void>(QEP_TRIG_(m_temp.fun, QEP_EMPTY_SIG_));
+        static_cast<void>(QEP_SUPER_(m_temp.fun));
         while (m_temp.fun != t) {
             ++ip;
             Q_ASSERT_ID(220, ip < MAX_NEST_DEPTH_);
             path[ip] = m_temp.fun;
-            static_cast<void>(QEP_TRIG_(m_temp.fun, QEP_EMPTY_SIG_));
+            static_cast<void>(QEP_SUPER_(m_temp.fun));
         }
         m_temp.fun = path[0];
 
@@ -278,7 +293,7 @@ void QHsm::dispatch(QEvt const * const e, std::uint_fast8_t const qs_id) {
                 QS_FUN_PRE_(s);      // the current state
             QS_END_PRE_()
 
-            r = QEP_TRIG_(s, QEP_EMPTY_SIG_); // find superstate of s
+            r = QEP_SUPER_(s); // find superstate of s
         }
     } while (r == Q_RET_SUPER);
 
@@ -291,22 +306,33 @@ void QHsm::dispatch(QEvt const * const e, std::uint_fast8_t const qs_id) {
         path[1] = t;
         path[2] = s;
 
-        // exit current state to transition source s...
-        //! @tr{RQP120C}
-        for (; t != s; t = m_temp.fun) {
-            // exit handled?
-            if (QEP_TRIG_(t, Q_EXIT_SIG) == Q_RET_HANDLED) {
-                QS_BEGIN_PRE_(QS_QEP_STATE_EXIT, qs_id)
-                    QS_OBJ_PRE_(this); // this state machine object
-                    QS_FUN_PRE_(t);    // the exited state
-                QS_END_PRE_()
-
-                // find superstate of t
-                static_cast<void>(QEP_TRIG_(t, QEP_EMPTY_SIG_));
-            }
+        std::int_fast8_t ip; // the entry path index
+#ifdef QHSM_TRAN_CACHE
+        // transition paths memoized?
+        if (m_tranCache != nullptr) {
+            ip = hsm_tranCached(path, qs_id); // the memoized HSM transition
+            t = s; // the current state has been exited up to the source
         }
+        else
+#endif // QHSM_TRAN_CACHE
+        {
+            // exit current state to transition source s...
+            //! @tr{RQP120C}
+            for (; t != s; t = m_temp.fun) {
+                // exit handled?
+                if (QEP_TRIG_(t, Q_EXIT_SIG) == Q_RET_HANDLED) {
+                    QS_BEGIN_PRE_(QS_QEP_STATE_EXIT, qs_id)
+                        QS_OBJ_PRE_(this); // this state machine object
+                        QS_FUN_PRE_(t);    // the exited state
+                    QS_END_PRE_()
+
+                    // find superstate of t
+                    static_cast<void>(QEP_SUPER_(t));
+                }
+            }
 
-        std::int_fast8_t ip = hsm_tran(path, qs_id); // the HSM transition
+            ip = hsm_tran(path, qs_id); // the HSM transition
+        }
 
 #ifdef Q_SPY
         if (r == Q_RET_TRAN_HIST) {
@@ -342,13 +368,13 @@ void QHsm::dispatch(QEvt const * const e, std::uint_fast8_t const qs_id) {
             path[0] = m_temp.fun;
 
             // find superstate
-            static_cast<void>(QEP_TRIG_(m_temp.fun, QEP_EMPTY_SIG_));
+            static_cast<void>(QEP_SUPER_(m_temp.fun));
 
             while (m_temp.fun != t) {
                 ++ip;
                 path[ip] = m_temp.fun;
                 // find superstate
-                static_cast<void>(QEP_TRIG_(m_temp.fun, QEP_EMPTY_SIG_));
+                static_cast<void>(QEP_SUPER_(m_temp.fun));
             }
             m_temp.fun = path[0];
 
@@ -431,7 +457,7 @@ std::int_fast8_t QHsm::hsm_tran(QStateHandler (&path)[MAX_NEST_DEPTH_],
     }
     else {
         // superstate of target
-        static_cast<void>(QEP_TRIG_(t, QEP_EMPTY_SIG_));
+        static_cast<void>(QEP_SUPER_(t));
         t = m_temp.fun;
 
         // (b) check source==target->super
@@ -440,7 +466,7 @@ std::int_fast8_t QHsm::hsm_tran(QStateHandler (&path)[MAX_NEST_DEPTH_],
         }
         else {
             // superstate of src
-            static_cast<void>(QEP_TRIG_(s, QEP_EMPTY_SIG_));
+            static_cast<void>(QEP_SUPER_(s));
 
             // (c) check source->super==target->super
             if (m_temp.fun == t) {
@@ -461,7 +487,7 @@ std::int_fast8_t QHsm::hsm_tran(QStateHandler (&path)[MAX_NEST_DEPTH_],
                     t = m_temp.fun; // save source->super
 
                     // find target->super->super
-                    QState r = QEP_TRIG_(path[1], QEP_EMPTY_SIG_);
+                    QState r = QEP_SUPER_(path[1]);
                     while (r == Q_RET_SUPER) {
                         ++ip;
                         path[ip] = m_temp.fun; // store the entry path
@@ -476,7 +502,7 @@ std::int_fast8_t QHsm::hsm_tran(QStateHandler (&path)[MAX_NEST_DEPTH_],
                         }
                         // it is not the source, keep going up
                         else {
-                            r = QEP_TRIG_(m_temp.fun, QEP_EMPTY_SIG_);
+                            r = QEP_SUPER_(m_temp.fun);
                         }
                     }
 
@@ -519,8 +545,7 @@ std::int_fast8_t QHsm::hsm_tran(QStateHandler (&path)[MAX_NEST_DEPTH_],
                                         QS_FUN_PRE_(t);
                                     QS_END_PRE_()
 
-                                    static_cast<void>(
-                                        QEP_TRIG_(t, QEP_EMPTY_SIG_));
+                                    static_cast<void>(QEP_SUPER_(t));
                                 }
                                 t = m_temp.fun; //  set to super of t
                                 iq = ip;
@@ -546,6 +571,340 @@ std::int_fast8_t QHsm::hsm_tran(QStateHandler (&path)[MAX_NEST_DEPTH_],
     return ip;
 }
 
+#ifdef QHSM_TRAN_CACHE
+//============================================================================
+//! @description
+//! helper function to execute transition sequence in a hierarchical state
+//! machine (HSM) through the memo of transition paths.
+//!
+//! @param[in,out] path array of pointers to state-handler functions:
+//!                     [0] the target, [1] the current state, [2] the
+//!                     source; on return the entry path
+//! @param[in]     qs_id QS-id of this state machine (for QS local filter)
+//!
+//! @returns
+//! the depth of the entry path stored in the @p path parameter.
+//!
+//! @note
+//! When the transition from the current state @p path[1] through the
+//! source @p path[2] to the target @p path[0] is memoized, this function
+//! exits the memoized states and copies the memoized entry path, without
+//! calling any state handlers with the empty signal. Otherwise, this
+//! function takes the transition the regular way and memoizes its path in
+//! a free entry of the cache (see NOTE1).
+//!
+std::int_fast8_t QHsm::hsm_tranCached(
+    QStateHandler (&path)[MAX_NEST_DEPTH_],
+    std::uint_fast8_t const qs_id)
+{
+    QStateHandler const tgt  = path[0];
+    QStateHandler const leaf = path[1];
+    QStateHandler const src  = path[2];
+    QHsmTranCache::Entry * const entry = &m_tranCache->m_entry[0];
+    std::uint_fast8_t hit  = QHSM_TRAN_CACHE; // not memoized yet
+    std::uint_fast8_t free = QHSM_TRAN_CACHE; // no free entry found yet
+    std::int_fast8_t ip;
+
+    // look up the transition, stopping at the first free entry...
+    std::uint_fast8_t i = QHsmTranCache::hash_(leaf, src, tgt);
+    for (std::uint_fast8_t n = QHSM_TRAN_CACHE; n > 0U; --n) {
+        std::uint8_t const state =
+            __atomic_load_n(&entry[i].state, __ATOMIC_ACQUIRE);
+        if (state == QHsmTranCache::VALID_) {
+            if ((entry[i].tgt == tgt) && (entry[i].src == src)
+                && (entry[i].leaf == leaf))
+            {
+                hit = i;
+                n = 1U; // cause breaking out of the loop
+            }
+        }
+        else if (state == QHsmTranCache::FREE_) {
+            free = i;
+            n = 1U; // cause breaking out of the loop
+        }
+        else { // entry being filled by another state machine, skip it
+        }
+        i = (i == 0U) ? static_cast<std::uint_fast8_t>(QHSM_TRAN_CACHE - 1U)
+                      : (i - 1U);
+    }
+
+    // transition memoized?
+    if (hit < QHSM_TRAN_CACHE) {
+        QHsmTranCache::Entry const * const e = &entry[hit];
+
+        // exit the current state up to the LCA...
+        for (std::uint_fast8_t k = 0U; k < e->nExit; ++k) {
+            QEP_EXIT_(e->exit[k]);
+        }
+
+        // copy the entry path
+        ip = static_cast<std::int_fast8_t>(e->nEntry) - 1;
+        for (std::int_fast8_t k = 0; k <= ip; ++k) {
+            path[k] = e->entry[k];
+        }
+    }
+    else {
+        // exit current state to transition source...
+        //! @tr{RQP120C}
+        for (QStateHandler t = leaf; t != src; t = m_temp.fun) {
+            // exit handled?
+            if (QEP_TRIG_(t, Q_EXIT_SIG) == Q_RET_HANDLED) {
+                QS_BEGIN_PRE_(QS_QEP_STATE_EXIT, qs_id)
+                    QS_OBJ_PRE_(this); // this state machine object
+                    QS_FUN_PRE_(t);    // the exited state
+                QS_END_PRE_()
+
+                // find superstate of t
+                static_cast<void>(QEP_SUPER_(t));
+            }
+        }
+
+        ip = hsm_tran(path, qs_id); // the HSM transition
+
+        // free entry found and claimed?
+        std::uint8_t state = QHsmTranCache::FREE_;
+        if ((free < QHSM_TRAN_CACHE)
+            && __atomic_compare_exchange_n(&entry[free].state, &state,
+                   static_cast<std::uint8_t>(QHsmTranCache::BUSY_), false,
+                   __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+            QHsmTranCache::Entry * const e = &entry[free];
+
+            // the LCA is the superstate of the last state on the entry
+            // path, or the target itself when the target is not entered
+            QStateHandler lca = tgt;
+            if (ip >= 0) {
+                static_cast<void>(QEP_SUPER_(path[ip]));
+                lca = m_temp.fun;
+            }
+
+            // the exited states form the chain from the current state
+            // up to (but not including) the LCA...
+            std::uint_fast8_t n = 0U;
+            QStateHandler t = leaf;
+            while ((t != lca)
+                   && (n < static_cast<std::uint_fast8_t>(MAX_NEST_DEPTH_)))
+            {
+                e->exit[n] = t;
+                ++n;
+                static_cast<void>(QEP_SUPER_(t));
+                t = m_temp.fun;
+            }
+
+            // the exit path fits in the entry?
+            if (t == lca) {
+                for (std::int_fast8_t k = 0; k <= ip; ++k) {
+                    e->entry[k] = path[k];
+                }
+                e->nExit  = static_cast<std::uint8_t>(n);
+                e->nEntry = static_cast<std::uint8_t>(ip + 1);
+                e->leaf   = leaf;
+                e->src    = src;
+                e->tgt    = tgt;
+                __atomic_store_n(&e->state,
+                    static_cast<std::uint8_t>(QHsmTranCache::VALID_),
+                    __ATOMIC_RELEASE); // publish the entry
+            }
+            else { // give the entry back
+                __atomic_store_n(&e->state,
+                    static_cast<std::uint8_t>(QHsmTranCache::FREE_),
+                    __ATOMIC_RELEASE);
+            }
+        }
+    }
+
+    static_cast<void>(qs_id); // unused parameter (if Q_SPY not defined)
+    return ip;
+}
+
+//============================================================================
+//! @description
+//! The cache is empty after construction. The entries are claimed as the
+//! transitions are taken.
+//!
+QHsmTranCache::QHsmTranCache() noexcept {
+    for (std::uint_fast8_t i = 0U; i < QHSM_TRAN_CACHE; ++i) {
+        m_entry[i].state = FREE_;
+    }
+}
+
+//============================================================================
+//! @description
+//! The state handlers are functions, so the low bits of their addresses
+//! carry little information and are shifted out before mixing.
+//!
+std::uint_fast8_t QHsmTranCache::hash_(QStateHandler const leaf,
+                                       QStateHandler const src,
+                                       QStateHandler const tgt) noexcept
+{
+    std::uintptr_t const h = (reinterpret_cast<std::uintptr_t>(leaf) >> 2U)
+        ^ (reinterpret_cast<std::uintptr_t>(src) >> 3U)
+        ^ (reinterpret_cast<std::uintptr_t>(tgt) >> 4U);
+    return static_cast<std::uint_fast8_t>(h % QHSM_TRAN_CACHE);
+}
+#endif // QHSM_TRAN_CACHE
+
+#ifdef QHSM_STATE_TABLE
+//============================================================================
+//! @description
+//! helper function to find the superstate of a given state in a
+//! hierarchical state machine (HSM) through the table of state parents.
+//!
+//! @param[in] s  pointer to the state-handler function
+//!
+//! @returns
+//! #Q_RET_SUPER with the superstate of @p s in m_temp.fun, or
+//! #Q_RET_IGNORED for the top state, exactly as the state handler @p s
+//! returns for the empty signal.
+//!
+//! @note
+//! The parent of a state not in the table yet is found by calling the
+//! state handler with the empty signal and is added to the table
+//! (see NOTE2).
+//!
+QState QHsm::hsm_super(QStateHandler const s) {
+    QState r;
+    if (m_stateTable == nullptr) { // no table of state parents?
+        r = QEP_TRIG_(s, QEP_EMPTY_SIG_);
+    }
+    else {
+        QHsmStateTable::Entry * const entry = &m_stateTable->m_entry[0];
+        std::uint_fast8_t free = QHSM_STATE_TABLE; // no free entry yet
+        r = Q_RET_NULL; // parent not found yet
+
+        // look up the state, stopping at the first free entry...
+        std::uint_fast8_t i = QHsmStateTable::hash_(s);
+        for (std::uint_fast8_t n = QHSM_STATE_TABLE; n > 0U; --n) {
+            std::uint8_t const state =
+                __atomic_load_n(&entry[i].state, __ATOMIC_ACQUIRE);
+            if (state == QHsmStateTable::VALID_) {
+                if (entry[i].fun == s) {
+                    if (entry[i].super != nullptr) {
+                        m_temp.fun = entry[i].super;
+                        r = Q_RET_SUPER;
+                    }
+                    else { // the top state
+                        r = Q_RET_IGNORED;
+                    }
+                    n = 1U; // cause breaking out of the loop
+                }
+            }
+            else if (state == QHsmStateTable::FREE_) {
+                free = i;
+                n = 1U; // cause breaking out of the loop
+            }
+            else { // entry being filled by another state machine, skip it
+            }
+            i = (i == 0U)
+                ? static_cast<std::uint_fast8_t>(QHSM_STATE_TABLE - 1U)
+                : (i - 1U);
+        }
+
+        // parent not found?
+        if (r == Q_RET_NULL) {
+            r = QEP_TRIG_(s, QEP_EMPTY_SIG_); // find superstate of s
+
+            // add the state to the table if the free entry can be claimed
+            if (((r == Q_RET_SUPER) || (r == Q_RET_IGNORED))
+                && (free < QHSM_STATE_TABLE))
+            {
+                static_cast<void>(m_stateTable->add_(free, s,
+                    (r == Q_RET_SUPER) ? m_temp.fun : nullptr));
+            }
+        }
+    }
+    return r;
+}
+
+//============================================================================
+//! @description
+//! The table is empty after construction. The parents of states are added
+//! as the state machines attached to the table probe them, or in advance
+//! with QP::QHsmStateTable::add().
+//!
+QHsmStateTable::QHsmStateTable() noexcept {
+    for (std::uint_fast8_t i = 0U; i < QHSM_STATE_TABLE; ++i) {
+        m_entry[i].state = FREE_;
+    }
+}
+
+//============================================================================
+//! @description
+//! Adds the parent of a given state to the table in advance, for example
+//! from a table generated together with the state machine code.
+//!
+//! @param[in] s      pointer to the state-handler function
+//! @param[in] super  pointer to the superstate of @p s (nullptr or
+//!                   &QP::QHsm::top for the states nested directly in top)
+//!
+//! @returns
+//! 'true' if the state has been added and 'false' if the table is full
+//!
+//! @note
+//! The parent of the top state (QP::QHsm::top()) is added implicitly
+//! the first time it is needed.
+//!
+bool QHsmStateTable::add(QStateHandler const s,
+                         QStateHandler const super) noexcept
+{
+    QStateHandler const parent = (super != nullptr)
+                                 ? super
+                                 : Q_STATE_CAST(&QHsm::top);
+    bool added = false;
+    std::uint_fast8_t i = hash_(s);
+    for (std::uint_fast8_t n = QHSM_STATE_TABLE; n > 0U; --n) {
+        std::uint8_t const state =
+            __atomic_load_n(&m_entry[i].state, __ATOMIC_ACQUIRE);
+        if ((state == VALID_) && (m_entry[i].fun == s)) {
+            n = 1U; // already in the table, cause breaking out of the loop
+        }
+        else if ((state == FREE_) && add_(i, s, parent)) {
+            added = true;
+            n = 1U; // cause breaking out of the loop
+        }
+        else { // occupied entry, keep probing
+        }
+        i = (i == 0U)
+            ? static_cast<std::uint_fast8_t>(QHSM_STATE_TABLE - 1U)
+            : (i - 1U);
+    }
+    return added;
+}
+
+//============================================================================
+//! @description
+//! Claims the free entry @p i of the table and publishes the parent
+//! @p super of the state @p s in it (nullptr for the top state).
+//!
+bool QHsmStateTable::add_(std::uint_fast8_t const i,
+                          QStateHandler const s,
+                          QStateHandler const super) noexcept
+{
+    std::uint8_t state = FREE_;
+    bool const claimed = __atomic_compare_exchange_n(&m_entry[i].state,
+        &state, static_cast<std::uint8_t>(BUSY_), false,
+        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+    if (claimed) {
+        m_entry[i].fun   = s;
+        m_entry[i].super = super;
+        __atomic_store_n(&m_entry[i].state,
+            static_cast<std::uint8_t>(VALID_),
+            __ATOMIC_RELEASE); // publish the entry
+    }
+    return claimed;
+}
+
+//============================================================================
+//! @description
+//! The state handlers are functions, so the low bits of their addresses
+//! carry little information and are shifted out.
+//!
+std::uint_fast8_t QHsmStateTable::hash_(QStateHandler const s) noexcept {
+    return static_cast<std::uint_fast8_t>(
+        (reinterpret_cast<std::uintptr_t>(s) >> 2U) % QHSM_STATE_TABLE);
+}
+#endif // QHSM_STATE_TABLE
+
 //============================================================================
 #ifdef Q_SPY
     QStateHandler QHsm::getStateHandler() noexcept {
@@ -585,7 +944,7 @@ bool QHsm::isIn(QStateHandler const s) noexcept {
             r = Q_RET_IGNORED; // cause breaking out of the loop
         }
         else {
-            r = QEP_TRIG_(m_temp.fun, QEP_EMPTY_SIG_);
+            r = QEP_SUPER_(m_temp.fun);
         }
     } while (r != Q_RET_IGNORED); // QHsm::top() state not reached
     m_temp.fun = m_state.fun; // restore the stable state configuration
@@ -630,7 +989,7 @@ QStateHandler QHsm::childState(QStateHandler const parent) noexcept {
         }
         else {
             child = m_temp.fun;
-            r = QEP_TRIG_(m_temp.fun, QEP_EMPTY_SIG_);
+            r = QEP_SUPER_(m_temp.fun);
         }
     } while (r != Q_RET_IGNORED); // QHsm::top() state not reached
     m_temp.fun = m_state.fun; // establish stable state configuration
@@ -645,5 +1004,274 @@ QStateHandler QHsm::childState(QStateHandler const parent) noexcept {
     return child; // return the child
 }
 
+#ifdef QHSM_CONSTEXPR
+//============================================================================
+//! @description
+//! Executes the top-most initial transition of a QP::QConstexprSm state
+//! machine: the action of the transition, the entry actions down to the
+//! target, and the nested initial transitions.
+//!
+//! @param[in]     me    pointer to the state machine
+//! @param[in,out] state the current state of the state machine
+//! @param[in]     tbl   the flattened tables of the state machine
+//! @param[in]     e     pointer to an extra parameter (might be NULL)
+//! @param[in]     qs_id QS-id of this state machine (for QS local filter)
+//!
+void QCsm::init(QHsm * const me, std::uint8_t &state,
+                QCsmTables const &tbl, void const * const e,
+                std::uint_fast8_t const qs_id)
+{
+    //! @pre the top-most initial transition must not be taken yet
+    Q_REQUIRE_ID(900, state == TOP);
+
+    QEvt const * const evt = static_cast<QEvt const *>(e);
+    QCsmTran const * const t = tbl.init;
+    if (t->action != nullptr) {
+        (*t->action)(me, evt); // action of the top-most initial tran.
+    }
+
+    QS_CRIT_STAT_
+    QS_BEGIN_PRE_(QS_QEP_STATE_INIT, qs_id)
+        QS_OBJ_PRE_(me);                     // this state machine object
+        QS_FUN_PRE_(Q_STATE_CAST(&QHsm::top)); // the source state
+        QS_FUN_PRE_(&tbl.state[t->target]);  // the target of the init tran.
+    QS_END_PRE_()
+
+    enter_(me, tbl, tbl.nTran, evt, qs_id);
+    state = tbl.leaf[tbl.nTran];
+
+    QS_BEGIN_PRE_(QS_QEP_INIT_TRAN, qs_id)
+        QS_TIME_PRE_();                   // time stamp
+        QS_OBJ_PRE_(me);                  // this state machine object
+        QS_FUN_PRE_(&tbl.state[state]);   // the new active state
+    QS_END_PRE_()
+
+    static_cast<void>(qs_id); // unused parameter (if Q_SPY not defined)
+}
+
+//============================================================================
+//! @description
+//! Dispatches an event to a QP::QConstexprSm state machine. The innermost
+//! transition enabled in the current state is looked up in the flattened
+//! tables. If its guard evaluates to 'false', the next candidate defined
+//! in the same state or in a superstate is tried. As in QP::QHsm, the
+//! action of the transition executes before the exit actions.
+//!
+//! @param[in]     me    pointer to the state machine
+//! @param[in,out] state the current state of the state machine
+//! @param[in]     tbl   the flattened tables of the state machine
+//! @param[in]     e     pointer to the event to be dispatched
+//! @param[in]     qs_id QS-id of this state machine (for QS local filter)
+//!
+void QCsm::dispatch(QHsm * const me, std::uint8_t &state,
+                    QCsmTables const &tbl, QEvt const * const e,
+                    std::uint_fast8_t const qs_id)
+{
+    std::uint8_t const s = state;
+
+    //! @pre the top-most initial transition must have been taken
+    Q_REQUIRE_ID(910, s < tbl.nState);
+
+    QS_CRIT_STAT_
+    QS_BEGIN_PRE_(QS_QEP_DISPATCH, qs_id)
+        QS_TIME_PRE_();             // time stamp
+        QS_SIG_PRE_(e->sig);        // the signal of the event
+        QS_OBJ_PRE_(me);            // this state machine object
+        QS_FUN_PRE_(&tbl.state[s]); // the current state
+    QS_END_PRE_()
+
+    // the innermost transition for the signal
+    std::uint_fast8_t k = (e->sig < tbl.nSig)
+        ? tbl.cell[(static_cast<std::uint_fast16_t>(s) * tbl.nSig) + e->sig]
+        : static_cast<std::uint_fast8_t>(NONE);
+
+    // skip the candidates with guards evaluating to 'false'...
+    while ((k != NONE) && (tbl.tran[k].guard != nullptr)
+           && (!(*tbl.tran[k].guard)(me, e)))
+    {
+        QS_BEGIN_PRE_(QS_QEP_UNHANDLED, qs_id)
+            QS_SIG_PRE_(e->sig);                       // the signal
+            QS_OBJ_PRE_(me);                           // this SM object
+            QS_FUN_PRE_(&tbl.state[tbl.tran[k].source]); // the state
+        QS_END_PRE_()
+
+        k = tbl.next[k];
+    }
+
+    if (k == NONE) { // event ignored?
+        QS_BEGIN_PRE_(QS_QEP_IGNORED, qs_id)
+            QS_TIME_PRE_();             // time stamp
+            QS_SIG_PRE_(e->sig);        // the signal of the event
+            QS_OBJ_PRE_(me);            // this state machine object
+            QS_FUN_PRE_(&tbl.state[s]); // the current state
+        QS_END_PRE_()
+    }
+    else {
+        QCsmTran const * const t = &tbl.tran[k];
+        if (t->action != nullptr) {
+            (*t->action)(me, e); // action of the transition
+        }
+
+        if (t->target == NONE) { // internal transition?
+            QS_BEGIN_PRE_(QS_QEP_INTERN_TRAN, qs_id)
+                QS_TIME_PRE_();                     // time stamp
+                QS_SIG_PRE_(e->sig);                // the signal
+                QS_OBJ_PRE_(me);                    // this SM object
+                QS_FUN_PRE_(&tbl.state[t->source]); // the source state
+            QS_END_PRE_()
+        }
+        else {
+            // exit the current state up to the LCA...
+            std::uint8_t const lca = tbl.lca[k];
+            std::uint_fast8_t n = tbl.depth[s]
+                - ((lca == TOP) ? 0U : tbl.depth[lca]);
+            for (std::uint8_t x = s; n > 0U; --n) {
+                QCsmState const * const st = &tbl.state[x];
+                if (st->exit != nullptr) {
+                    (*st->exit)(me, e); // exit action
+
+                    QS_BEGIN_PRE_(QS_QEP_STATE_EXIT, qs_id)
+                        QS_OBJ_PRE_(me);  // this state machine object
+                        QS_FUN_PRE_(st);  // the exited state
+                    QS_END_PRE_()
+                }
+                x = st->parent;
+            }
+
+            enter_(me, tbl, k, e, qs_id);
+            state = tbl.leaf[k];
+
+            QS_BEGIN_PRE_(QS_QEP_TRAN, qs_id)
+                QS_TIME_PRE_();                     // time stamp
+                QS_SIG_PRE_(e->sig);                // the signal
+                QS_OBJ_PRE_(me);                    // this SM object
+                QS_FUN_PRE_(&tbl.state[t->source]); // the source
+                QS_FUN_PRE_(&tbl.state[state]);     // the new active state
+            QS_END_PRE_()
+        }
+    }
+    static_cast<void>(qs_id); // unused parameter (if Q_SPY not defined)
+}
+
+//============================================================================
+//! @description
+//! Tests if the current state @p state of a QP::QConstexprSm is the state
+//! @p s or is nested in it.
+//!
+bool QCsm::isIn(QCsmTables const &tbl, std::uint8_t const state,
+                std::uint8_t const s) noexcept
+{
+    std::uint8_t x = state;
+    while ((x != s) && (x < tbl.nState)) {
+        x = tbl.state[x].parent;
+    }
+    return x == s;
+}
+
+//============================================================================
+//! @description
+//! Executes the entry actions along the precomputed entry path of the
+//! transition @p k (from the LCA down to the leaf state), and the
+//! initial transitions of the target and of the targets of these initial
+//! transitions.
+//!
+void QCsm::enter_(QHsm * const me, QCsmTables const &tbl,
+                  std::uint_fast8_t const k, QEvt const * const e,
+                  std::uint_fast8_t const qs_id)
+{
+    QCsmTran const * const t = (k < tbl.nTran) ? &tbl.tran[k] : tbl.init;
+    std::uint8_t const lca  = tbl.lca[k];
+    std::uint8_t const leaf = tbl.leaf[k];
+    std::uint8_t src = t->target; // source of the next initial transition
+
+    // target not entered (transition to a superstate)?
+    if (src == lca) {
+        src = init_(me, tbl, src, e, qs_id);
+    }
+
+    std::uint8_t const *path = &tbl.path[k * tbl.maxDepth];
+    std::uint_fast8_t n = tbl.depth[leaf]
+        - ((lca == TOP) ? 0U : tbl.depth[lca]);
+    for (; n > 0U; --n) {
+        std::uint8_t const x = *path;
+        ++path;
+        QCsmState const * const st = &tbl.state[x];
+        if (st->entry != nullptr) {
+            (*st->entry)(me, e); // entry action
+
+            QS_CRIT_STAT_
+            QS_BEGIN_PRE_(QS_QEP_STATE_ENTRY, qs_id)
+                QS_OBJ_PRE_(me);  // this state machine object
+                QS_FUN_PRE_(st);  // the entered state
+            QS_END_PRE_()
+        }
+        if (x == src) { // initial transition of this state next?
+            src = init_(me, tbl, x, e, qs_id);
+        }
+    }
+    static_cast<void>(qs_id); // unused parameter (if Q_SPY not defined)
+}
+
+//============================================================================
+//! @description
+//! Executes the action of the initial transition of the state @p s.
+//!
+//! @returns
+//! the target of the initial transition (QCsm::NONE for a leaf state)
+//!
+std::uint8_t QCsm::init_(QHsm * const me, QCsmTables const &tbl,
+                         std::uint8_t const s, QEvt const * const e,
+                         std::uint_fast8_t const qs_id)
+{
+    QCsmState const * const st = &tbl.state[s];
+    if (st->init != NONE) {
+        if (st->initAct != nullptr) {
+            (*st->initAct)(me, e); // action of the initial transition
+        }
+
+        QS_CRIT_STAT_
+        QS_BEGIN_PRE_(QS_QEP_STATE_INIT, qs_id)
+            QS_OBJ_PRE_(me);                  // this state machine object
+            QS_FUN_PRE_(st);                  // the source state
+            QS_FUN_PRE_(&tbl.state[st->init]); // the target of the init tran.
+        QS_END_PRE_()
+    }
+    static_cast<void>(qs_id); // unused parameter (if Q_SPY not defined)
+    return st->init;
+}
+
+#endif // QHSM_CONSTEXPR
+
 } // namespace QP
 
+
+//============================================================================
+// NOTE1:
+// With QHSM_TRAN_CACHE, the transition path is memoized under the key
+// (current state, source, target). The QHsm state handlers must return the
+// same superstate for the empty signal regardless of the extended state
+// (which QHsm requires anyway), so the states exited and entered are the
+// same each time the transition is taken from the same current state.
+// All states exited by a QHsm transition form one contiguous chain from the
+// current state up to (but not including) the least common ancestor (LCA),
+// so only that chain and the entry path are memoized. The transition to
+// history is memoized under its actual target state. The nested initial
+// transitions executed after entering the target are not memoized, because
+// they are discovered from the target downwards in any case. Transition
+// paths longer than the QHsm nesting limit are not memoized.
+//
+
+//============================================================================
+// NOTE2:
+// With QHSM_STATE_TABLE, all superstate probes of QHsm go through the table
+// of state parents (see QHsm::hsm_super()). This covers the discovery of
+// transition and initial-transition paths, the superstate of a state that
+// left an event unhandled due to a guard, QHsm::isIn(), and
+// QHsm::childState(). The states visited by QHsm::init() are added while
+// the top-most initial transition is taken, and any other state the first
+// time its parent is needed, so the table can also start empty. Regular
+// bubbling of an event up the hierarchy still calls every superstate with
+// that event, because each superstate must get the chance to handle it.
+// The superstate returned from the handler in that case comes with the
+// call and needs no table lookup.
+//
@@ -51,8 +51,14 @@ Q_DEFINE_THIS_MODULE("qf_actq")
 
 } // unnamed namespace
 
+#if (defined QF_ACTIVE_CONFLATE) && (defined QF_EQUEUE_LOCKFREE)
+    #error "QF_ACTIVE_CONFLATE is not supported with QF_EQUEUE_LOCKFREE"
+#endif
+
 namespace QP {
 
+#ifndef QF_EQUEUE_LOCKFREE
+
 #ifdef Q_SPY
 //============================================================================
 //! @description
@@ -96,7 +102,45 @@ bool QActive::post_(QEvt const * const e,
     Q_REQUIRE_ID(100, e != nullptr);
 
     QF_CRIT_STAT_
-    QF_CRIT_E_();
+    QACTIVE_EQUEUE_CRIT_E_(this);
+
+#ifdef QF_ACTIVE_CONFLATE
+    // conflated signal with an event already pending? see NOTE1
+    QEvt const * volatile * const entry = conflateEntry_(e->sig);
+    if (entry != nullptr) {
+        QEvt const * const old = *entry; // the pending (stale) event
+
+        // is it a dynamic event?
+        if (e->poolId_ != 0U) {
+            QF_EVT_REF_LOCK_(e);
+            QF_EVT_REF_CTR_INC_(e); // increment the reference counter
+            QF_EVT_REF_UNLOCK_(e);
+        }
+        *entry = e; // replace the pending event in place
+
+        QS_BEGIN_NOCRIT_PRE_(QS_QF_ACTIVE_CONFLATE, m_prio)
+            QS_TIME_PRE_();               // timestamp
+            QS_OBJ_PRE_(sender);          // the sender object
+            QS_SIG_PRE_(e->sig);          // the signal of the event
+            QS_OBJ_PRE_(this);            // this active object
+            QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool-Id & ref-ctr
+            QS_EQC_PRE_(m_eQueue.m_nFree); // number of free entries
+            QS_EQC_PRE_(m_eQueue.m_nMin); // min number of free entries
+        QS_END_NOCRIT_PRE_()
+
+#ifdef Q_UTEST
+        if (QS_LOC_CHECK_(m_prio)) {
+            QS::onTestPost(sender, this, e, true);
+        }
+#endif
+
+        QACTIVE_EQUEUE_CRIT_X_(this);
+
+        QF::gc(old); // recycle the replaced event
+        return true;
+    }
+#endif // QF_ACTIVE_CONFLATE
+
     QEQueueCtr nFree = m_eQueue.m_nFree; // get volatile into the temporary
 
     // test-probe#1 for faking queue overflow
@@ -112,7 +156,8 @@ bool QActive::post_(QEvt const * const e,
         }
         else {
             status = false; // cannot post
-            Q_ERROR_CRIT_(110); // must be able to post the event
+            // must be able to post the event
+            Q_ERROR_IN_CRIT_(110, QACTIVE_EQUEUE_CRIT_X_(this));
         }
     }
     else if (nFree > static_cast<QEQueueCtr>(margin)) {
@@ -124,7 +169,9 @@ bool QActive::post_(QEvt const * const e,
 
     // is it a dynamic event?
     if (e->poolId_ != 0U) {
+        QF_EVT_REF_LOCK_(e);
         QF_EVT_REF_CTR_INC_(e); // increment the reference counter
+        QF_EVT_REF_UNLOCK_(e);
     }
 
     if (status) { // can post the event?
@@ -172,7 +219,7 @@ bool QActive::post_(QEvt const * const e,
             m_eQueue.m_head = (m_eQueue.m_head - 1U);
         }
 
-        QF_CRIT_X_();
+        QACTIVE_EQUEUE_CRIT_X_(this);
     }
     else { // cannot post the event
 
@@ -196,7 +243,7 @@ bool QActive::post_(QEvt const * const e,
         }
 #endif
 
-        QF_CRIT_X_();
+        QACTIVE_EQUEUE_CRIT_X_(this);
 
         QF::gc(e); // recycle the event to avoid a leak
     }
@@ -221,7 +268,7 @@ bool QActive::post_(QEvt const * const e,
 void QActive::postLIFO(QEvt const * const e) noexcept {
 
     QF_CRIT_STAT_
-    QF_CRIT_E_();
+    QACTIVE_EQUEUE_CRIT_E_(this);
     QEQueueCtr nFree = m_eQueue.m_nFree;// tmp to avoid UB for volatile access
 
     QS_TEST_PROBE_DEF(&QActive::postLIFO)
@@ -230,11 +277,14 @@ void QActive::postLIFO(QEvt const * const e) noexcept {
     )
 
     // the queue must be able to accept the event (cannot overflow)
-    Q_ASSERT_CRIT_(210, nFree != 0U);
+    Q_ASSERT_IN_CRIT_(210, nFree != 0U,
+                      QACTIVE_EQUEUE_CRIT_X_(this));
 
     // is it a dynamic event?
     if (e->poolId_ != 0U) {
+        QF_EVT_REF_LOCK_(e);
         QF_EVT_REF_CTR_INC_(e); // increment the reference counter
+        QF_EVT_REF_UNLOCK_(e);
     }
 
     --nFree;  // one free entry just used up
@@ -279,7 +329,7 @@ void QActive::postLIFO(QEvt const * const e) noexcept {
 
         m_eQueue.m_ring[m_eQueue.m_tail] = frontEvt;
     }
-    QF_CRIT_X_();
+    QACTIVE_EQUEUE_CRIT_X_(this);
 }
 
 //============================================================================
@@ -304,7 +354,7 @@ void QActive::postLIFO(QEvt const * const e) noexcept {
 QEvt const *QActive::get_(void) noexcept {
 
     QF_CRIT_STAT_
-    QF_CRIT_E_();
+    QACTIVE_EQUEUE_CRIT_E_(this);
     QACTIVE_EQUEUE_WAIT_(this); // wait for event to arrive directly
 
     // always remove evt from the front
@@ -335,7 +385,8 @@ QEvt const *QActive::get_(void) noexcept {
         m_eQueue.m_frontEvt = nullptr;
 
         // all entries in the queue must be free (+1 for fronEvt)
-        Q_ASSERT_CRIT_(310, nFree == (m_eQueue.m_end + 1U));
+        Q_ASSERT_IN_CRIT_(310, nFree == (m_eQueue.m_end + 1U),
+                          QACTIVE_EQUEUE_CRIT_X_(this));
 
         QS_BEGIN_NOCRIT_PRE_(QS_QF_ACTIVE_GET_LAST, m_prio)
             QS_TIME_PRE_();                      // timestamp
@@ -344,7 +395,9 @@ QEvt const *QActive::get_(void) noexcept {
             QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool-Id & ref-ctr
         QS_END_NOCRIT_PRE_()
     }
-    QF_CRIT_X_();
+    QACTIVE_EQUEUE_CRIT_X_(this);
+
+    QACTIVE_EQUEUE_FREED_(this); // one more free entry in the queue
     return e;
 }
 
@@ -372,14 +425,371 @@ std::uint_fast16_t QF::getQueueMin(std::uint_fast8_t const prio) noexcept {
                       && (active_[prio] != nullptr));
 
     QF_CRIT_STAT_
-    QF_CRIT_E_();
+    QACTIVE_EQUEUE_CRIT_E_(active_[prio]);
     std::uint_fast16_t const min =
         static_cast<std::uint_fast16_t>(active_[prio]->m_eQueue.m_nMin);
-    QF_CRIT_X_();
+    QACTIVE_EQUEUE_CRIT_X_(active_[prio]);
 
     return min;
 }
 
+#ifdef QF_ACTIVE_CONFLATE
+//============================================================================
+//! @description
+//! Enables or disables the conflation ("latest-value" semantics) of the
+//! signal @p sig in the event queue of this active object. Posting an event
+//! with a conflated signal, while another event with the same signal is
+//! still pending in the queue, replaces the pending event in place and
+//! garbage-collects it (see QActive::post_()). Such a post always succeeds
+//! and does not consume a queue entry.
+//!
+//! @param[in] sig      the signal to conflate
+//!                     (Q_USER_SIG..QF_ACTIVE_CONFLATE-1)
+//! @param[in] conflate 'true' to conflate the signal, 'false' to stop
+//!
+//! @usage
+//! @code
+//! Q_STATE_DEF(Monitor, initial) {
+//!     setConflate(SENSOR_SAMPLE_SIG, true); // only the newest sample
+//!     . . .
+//! }
+//! @endcode
+//!
+void QActive::setConflate(enum_t const sig, bool const conflate) noexcept {
+    //! @pre the signal must be a user signal in the conflation range
+    Q_REQUIRE_ID(500, (Q_USER_SIG <= sig)
+        && (sig < static_cast<enum_t>(QF_ACTIVE_CONFLATE)));
+
+    std::uint_fast16_t const s = static_cast<std::uint_fast16_t>(sig);
+    std::uint8_t const bit = static_cast<std::uint8_t>(1U << (s & 7U));
+
+    QF_CRIT_STAT_
+    QACTIVE_EQUEUE_CRIT_E_(this);
+    if (conflate) {
+        m_conflate[s >> 3U] = static_cast<std::uint8_t>(
+            m_conflate[s >> 3U] | bit);
+    }
+    else {
+        m_conflate[s >> 3U] = static_cast<std::uint8_t>(
+            m_conflate[s >> 3U] & static_cast<std::uint8_t>(~bit));
+    }
+    QACTIVE_EQUEUE_CRIT_X_(this);
+}
+
+//============================================================================
+//! @description
+//! Finds the entry of the event queue (the front event or a ring-buffer
+//! entry) holding the oldest pending event with the signal @p sig, but
+//! only when @p sig is conflated in this active object.
+//!
+//! @returns
+//! pointer to the queue entry or nullptr if the signal is not conflated or
+//! no event with this signal is pending.
+//!
+//! @note
+//! Must be called inside the critical section of the event queue.
+//!
+QEvt const * volatile *QActive::conflateEntry_(QSignal const sig) noexcept {
+    QEvt const * volatile *entry = nullptr;
+
+    // conflated signal and any events pending in the queue?
+    if ((sig < QF_ACTIVE_CONFLATE)
+        && ((m_conflate[sig >> 3U] & (1U << (sig & 7U))) != 0U)
+        && (m_eQueue.m_frontEvt != nullptr))
+    {
+        if (m_eQueue.m_frontEvt->sig == sig) {
+            entry = &m_eQueue.m_frontEvt;
+        }
+        else {
+            // search the used ring-buffer entries from the tail (oldest)
+            QEQueueCtr n = m_eQueue.m_end - m_eQueue.m_nFree;
+            QEQueueCtr i = m_eQueue.m_tail;
+            for (; n > 0U; --n) {
+                if (m_eQueue.m_ring[i]->sig == sig) {
+                    entry = &m_eQueue.m_ring[i];
+                    break;
+                }
+                if (i == 0U) { // need to wrap?
+                    i = m_eQueue.m_end; // wrap around
+                }
+                i = (i - 1U);
+            }
+        }
+    }
+    return entry;
+}
+#endif // QF_ACTIVE_CONFLATE
+
+#else // QF_EQUEUE_LOCKFREE
+
+//============================================================================
+// Lock-free multiple-producer/single-consumer event queue
+//
+// The producers first reserve a free entry by atomically decrementing
+// m_nFree (which also enforces the margin), then claim the entry at m_head
+// and finally store the event pointer into the claimed entry. The consumer
+// (the thread of the AO) owns m_tail and recognizes the claimed, but not
+// yet stored entries by the nullptr value.
+//
+// The m_frontEvt location is not used for events posted to the ring buffer.
+// It serves only QP::QTicker, which delivers its single tick event directly.
+//
+
+#ifdef Q_SPY
+bool QActive::post_(QEvt const * const e,
+                    std::uint_fast16_t const margin,
+                    void const * const sender) noexcept
+#else
+bool QActive::post_(QEvt const * const e,
+                    std::uint_fast16_t const margin) noexcept
+#endif
+{
+    //! @pre event pointer must be valid
+    Q_REQUIRE_ID(100, e != nullptr);
+
+    QS_TEST_PROBE_DEF(&QActive::post_)
+
+    // reserve one free entry in the queue, honoring the margin
+    QEQueueCtr nFree = __atomic_load_n(&m_eQueue.m_nFree, __ATOMIC_RELAXED);
+    bool status;
+    for (;;) {
+        // test-probe#1 for faking queue overflow
+        QS_TEST_PROBE_ID(1,
+            nFree = 0U;
+        )
+
+        if (margin == QF_NO_MARGIN) {
+            if (nFree > 0U) {
+                status = true; // can post
+            }
+            else {
+                status = false; // cannot post
+                Q_ERROR_ID(110); // must be able to post the event
+            }
+        }
+        else if (nFree > static_cast<QEQueueCtr>(margin)) {
+            status = true; // can post
+        }
+        else {
+            status = false; // cannot post, but don't assert
+        }
+
+        if (!status) {
+            break;
+        }
+        if (__atomic_compare_exchange_n(&m_eQueue.m_nFree, &nFree,
+                static_cast<QEQueueCtr>(nFree - 1U), true,
+                __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+        {
+            break; // entry reserved
+        }
+    }
+
+    // is it a dynamic event?
+    if (e->poolId_ != 0U) {
+        QF_CRIT_STAT_
+        QF_EVT_CRIT_E_(e);
+        QF_EVT_REF_CTR_INC_(e); // increment the reference counter
+        QF_EVT_CRIT_X_(e);
+    }
+
+    QS_CRIT_STAT_
+    if (status) { // can post the event?
+
+        --nFree;  // one free entry just used up
+
+        // update the minimum so far
+        QEQueueCtr nMin = __atomic_load_n(&m_eQueue.m_nMin,
+                                          __ATOMIC_RELAXED);
+        while ((nMin > nFree)
+               && (!__atomic_compare_exchange_n(&m_eQueue.m_nMin, &nMin,
+                        nFree, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)))
+        {}
+
+        QS_BEGIN_PRE_(QS_QF_ACTIVE_POST, m_prio)
+            QS_TIME_PRE_();               // timestamp
+            QS_OBJ_PRE_(sender);          // the sender object
+            QS_SIG_PRE_(e->sig);          // the signal of the event
+            QS_OBJ_PRE_(this);            // this active object
+            QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool-Id & ref-ctr
+            QS_EQC_PRE_(nFree);           // number of free entries
+            QS_EQC_PRE_(m_eQueue.m_nMin); // min number of free entries
+        QS_END_PRE_()
+
+#ifdef Q_UTEST
+        if (QS_LOC_CHECK_(m_prio)) {
+            QS::onTestPost(sender, this, e, status);
+        }
+#endif
+        // claim the entry at the head (counter clockwise)
+        QEQueueCtr head = __atomic_load_n(&m_eQueue.m_head, __ATOMIC_RELAXED);
+        QEQueueCtr next;
+        do {
+            next = static_cast<QEQueueCtr>(
+                       ((head == 0U) ? m_eQueue.m_end : head) - 1U);
+        } while (!__atomic_compare_exchange_n(&m_eQueue.m_head, &head, next,
+                     true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+        // publish the event in the claimed entry
+        __atomic_store_n(&m_eQueue.m_ring[head], e, __ATOMIC_RELEASE);
+        QACTIVE_EQUEUE_SIGNAL_(this); // signal the event queue
+    }
+    else { // cannot post the event
+
+        QS_BEGIN_PRE_(QS_QF_ACTIVE_POST_ATTEMPT, m_prio)
+            QS_TIME_PRE_();           // timestamp
+            QS_OBJ_PRE_(sender);      // the sender object
+            QS_SIG_PRE_(e->sig);      // the signal of the event
+            QS_OBJ_PRE_(this);        // this active object
+            QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool-Id & ref-ctr
+            QS_EQC_PRE_(nFree);       // number of free entries
+            QS_EQC_PRE_(margin);      // margin requested
+        QS_END_PRE_()
+
+#ifdef Q_UTEST
+        if (QS_LOC_CHECK_(m_prio)) {
+            QS::onTestPost(sender, this, e, status);
+        }
+#endif
+
+        QF::gc(e); // recycle the event to avoid a leak
+    }
+
+    return status;
+}
+
+//============================================================================
+//! @note
+//! With the lock-free queue, postLIFO() can be called only from the thread
+//! of the active object itself (self-posting), because it manipulates the
+//! consumer end of the queue.
+//!
+void QActive::postLIFO(QEvt const * const e) noexcept {
+
+    QEQueueCtr nFree = __atomic_load_n(&m_eQueue.m_nFree, __ATOMIC_RELAXED);
+    QS_TEST_PROBE_DEF(&QActive::postLIFO)
+    do {
+        QS_TEST_PROBE_ID(1,
+            nFree = 0U;
+        )
+
+        // the queue must be able to accept the event (cannot overflow)
+        Q_ASSERT_ID(210, nFree != 0U);
+
+    } while (!__atomic_compare_exchange_n(&m_eQueue.m_nFree, &nFree,
+                 static_cast<QEQueueCtr>(nFree - 1U), true,
+                 __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+
+    // is it a dynamic event?
+    if (e->poolId_ != 0U) {
+        QF_CRIT_STAT_
+        QF_EVT_CRIT_E_(e);
+        QF_EVT_REF_CTR_INC_(e); // increment the reference counter
+        QF_EVT_CRIT_X_(e);
+    }
+
+    --nFree;  // one free entry just used up
+    QEQueueCtr nMin = __atomic_load_n(&m_eQueue.m_nMin, __ATOMIC_RELAXED);
+    while ((nMin > nFree)
+           && (!__atomic_compare_exchange_n(&m_eQueue.m_nMin, &nMin,
+                    nFree, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)))
+    {}
+
+    QS_CRIT_STAT_
+    QS_BEGIN_PRE_(QS_QF_ACTIVE_POST_LIFO, m_prio)
+        QS_TIME_PRE_();                      // timestamp
+        QS_SIG_PRE_(e->sig);                 // the signal of this event
+        QS_OBJ_PRE_(this);                   // this active object
+        QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool-Id & ref-ctr
+        QS_EQC_PRE_(nFree);                  // number of free entries
+        QS_EQC_PRE_(m_eQueue.m_nMin);        // min number of free entries
+    QS_END_PRE_()
+
+#ifdef Q_UTEST
+    if (QS_LOC_CHECK_(m_prio)) {
+        QS::onTestPost(nullptr, this, e, true);
+    }
+#endif
+
+    // insert the event just before the tail (clockwise), which is the entry
+    // the consumer will read next. The reservation guarantees that this
+    // entry is not claimed by any producer.
+    QEQueueCtr tail = static_cast<QEQueueCtr>(m_eQueue.m_tail + 1U);
+    if (tail == m_eQueue.m_end) { // need to wrap the tail?
+        tail = 0U; // wrap around
+    }
+    m_eQueue.m_tail = tail;
+    __atomic_store_n(&m_eQueue.m_ring[tail], e, __ATOMIC_RELEASE);
+    QACTIVE_EQUEUE_SIGNAL_(this); // signal the event queue
+}
+
+//============================================================================
+QEvt const *QActive::get_(void) noexcept {
+
+    QACTIVE_EQUEUE_WAIT_(this); // wait for event to arrive
+
+    QS_CRIT_STAT_
+
+    // event delivered directly (QP::QTicker)?
+    QEvt const *e = __atomic_load_n(&m_eQueue.m_frontEvt, __ATOMIC_ACQUIRE);
+    if (e != nullptr) {
+        __atomic_store_n(&m_eQueue.m_frontEvt,
+                         static_cast<QEvt const *>(nullptr),
+                         __ATOMIC_RELEASE);
+
+        QS_BEGIN_PRE_(QS_QF_ACTIVE_GET_LAST, m_prio)
+            QS_TIME_PRE_();                      // timestamp
+            QS_SIG_PRE_(e->sig);                 // the signal of this event
+            QS_OBJ_PRE_(this);                   // this active object
+            QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool-Id & ref-ctr
+        QS_END_PRE_()
+
+        return e;
+    }
+
+    // remove the event from the tail
+    QEQueueCtr const tail = m_eQueue.m_tail;
+    for (;;) {
+        e = __atomic_load_n(&m_eQueue.m_ring[tail], __ATOMIC_ACQUIRE);
+        if (e != nullptr) {
+            break;
+        }
+        // the entry is claimed, but the producer has not stored it yet
+        QF_EQUEUE_LF_RELAX_();
+    }
+    m_eQueue.m_ring[tail] = nullptr; // free the entry for the producers
+    m_eQueue.m_tail = static_cast<QEQueueCtr>(
+                          ((tail == 0U) ? m_eQueue.m_end : tail) - 1U);
+
+    // release the reserved entry
+    QEQueueCtr const nFree = __atomic_add_fetch(&m_eQueue.m_nFree, 1U,
+                                                __ATOMIC_RELEASE);
+
+    QS_BEGIN_PRE_(QS_QF_ACTIVE_GET, m_prio)
+        QS_TIME_PRE_();                      // timestamp
+        QS_SIG_PRE_(e->sig);                 // the signal of this event
+        QS_OBJ_PRE_(this);                   // this active object
+        QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool-Id & ref-ctr
+        QS_EQC_PRE_(nFree);                  // number of free entries
+    QS_END_PRE_()
+    static_cast<void>(nFree); // unused without QS
+
+    QACTIVE_EQUEUE_FREED_(this); // one more free entry in the queue
+    return e;
+}
+
+//============================================================================
+std::uint_fast16_t QF::getQueueMin(std::uint_fast8_t const prio) noexcept {
+
+    Q_REQUIRE_ID(400, (prio <= QF_MAX_ACTIVE)
+                      && (active_[prio] != nullptr));
+
+    return static_cast<std::uint_fast16_t>(
+        __atomic_load_n(&active_[prio]->m_eQueue.m_nMin, __ATOMIC_RELAXED));
+}
+
+#endif // QF_EQUEUE_LOCKFREE
+
 //============================================================================
 QTicker::QTicker(std::uint_fast8_t const tickRate) noexcept
   : QActive(nullptr)
@@ -402,11 +812,17 @@ void QTicker::dispatch(QEvt const * const e,
     static_cast<void>(e); // unused parameter
     static_cast<void>(qs_id); // unused parameter
 
+#ifndef QF_EQUEUE_LOCKFREE
     QF_CRIT_STAT_
-    QF_CRIT_E_();
+    QACTIVE_EQUEUE_CRIT_E_(this);
     QEQueueCtr nTicks = m_eQueue.m_tail; // # ticks since the last call
     m_eQueue.m_tail = 0U; // clear the # ticks
-    QF_CRIT_X_();
+    QACTIVE_EQUEUE_CRIT_X_(this);
+#else
+    // # ticks since the last call (and clear the # ticks)
+    QEQueueCtr nTicks = __atomic_exchange_n(&m_eQueue.m_tail, 0U,
+                                            __ATOMIC_ACQ_REL);
+#endif
 
     for (; nTicks > 0U; --nTicks) {
         QF::TICK_X(static_cast<std::uint_fast8_t>(m_eQueue.m_head), this);
@@ -432,16 +848,16 @@ bool QTicker::post_(QEvt const * const e, std::uint_fast16_t const margin)
     static_cast<void>(e);      // unused parameter
     static_cast<void>(margin); // unused parameter
 
-    QF_CRIT_STAT_
-    QF_CRIT_E_();
-    if (m_eQueue.m_frontEvt == nullptr) {
-
 #ifdef Q_EVT_CTOR
-        static QEvt const tickEvt(0U, QEvt::STATIC_EVT);
+    static QEvt const tickEvt(0U, QEvt::STATIC_EVT);
 #else
-        static QEvt const tickEvt = { 0U, 0U, 0U };
+    static QEvt const tickEvt = { 0U, 0U, 0U };
 #endif // Q_EVT_CTOR
 
+#ifndef QF_EQUEUE_LOCKFREE
+    QF_CRIT_STAT_
+    QACTIVE_EQUEUE_CRIT_E_(this);
+    if (m_eQueue.m_frontEvt == nullptr) {
         m_eQueue.m_frontEvt = &tickEvt; // deliver event directly
         m_eQueue.m_nFree = (m_eQueue.m_nFree - 1U); // one less free event
 
@@ -461,7 +877,31 @@ bool QTicker::post_(QEvt const * const e, std::uint_fast16_t const margin)
         QS_EQC_PRE_(0U);     // min number of free entries
     QS_END_NOCRIT_PRE_()
 
-    QF_CRIT_X_();
+    QACTIVE_EQUEUE_CRIT_X_(this);
+#else
+    // account for one more tick event
+    static_cast<void>(__atomic_add_fetch(&m_eQueue.m_tail, 1U,
+                                         __ATOMIC_ACQ_REL));
+
+    // deliver the tick event directly, unless it is still pending
+    QEvt const *frontEvt = nullptr;
+    if (__atomic_compare_exchange_n(&m_eQueue.m_frontEvt, &frontEvt,
+            &tickEvt, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+    {
+        QACTIVE_EQUEUE_SIGNAL_(this); // signal the event queue
+    }
+
+    QS_CRIT_STAT_
+    QS_BEGIN_PRE_(QS_QF_ACTIVE_POST, m_prio)
+        QS_TIME_PRE_();      // timestamp
+        QS_OBJ_PRE_(sender); // the sender object
+        QS_SIG_PRE_(0U);     // the signal of the event
+        QS_OBJ_PRE_(this);   // this active object
+        QS_2U8_PRE_(0U, 0U); // pool-Id & ref-ctr
+        QS_EQC_PRE_(0U);     // number of free entries
+        QS_EQC_PRE_(0U);     // min number of free entries
+    QS_END_PRE_()
+#endif // QF_EQUEUE_LOCKFREE
 
     return true; // the event is always posted correctly
 }
@@ -473,3 +913,18 @@ void QTicker::postLIFO(QEvt const * const e) noexcept {
 }
 
 } // namespace QP
+
+//============================================================================
+// NOTE1:
+// With QF_ACTIVE_CONFLATE, posting an event with a signal conflated in the
+// recipient AO (see QActive::setConflate()) replaces an event with the same
+// signal still pending in the AO's queue, so the AO processes only the most
+// recent value and the queue cannot fill up with stale events. The replaced
+// event keeps its position in the queue (its order relative to the other
+// pending events), while the number of free entries (m_nFree) and the
+// minimum (m_nMin) do not change, because no entry is consumed. Such a post
+// produces the QS_QF_ACTIVE_CONFLATE trace record instead of
+// QS_QF_ACTIVE_POST and always succeeds, regardless of the margin.
+// Only QActive::post_() conflates events. QActive::postLIFO() always inserts
+// the event, and QF::publish_() delivers events through QActive::post_().
+//
@@ -116,7 +116,7 @@ bool QActive::recall(QEQueue * const eq) noexcept {
         QActive::postLIFO(e); // post it to the _front_ of the AO's queue
 
         QF_CRIT_STAT_
-        QF_CRIT_E_();
+        QF_EVT_CRIT_E_(e);
 
         // is it a dynamic event?
         if (e->poolId_ != 0U) {
@@ -125,7 +125,8 @@ bool QActive::recall(QEQueue * const eq) noexcept {
             // at least twice: once in the deferred event queue (eq->get()
             // did NOT decrement the reference counter) and once in the
             // AO's event queue.
-            Q_ASSERT_CRIT_(210, e->refCtr_ >= 2U);
+            Q_ASSERT_IN_CRIT_(210, e->refCtr_ >= 2U,
+                              QF_EVT_CRIT_X_(e));
 
             // we need to decrement the reference counter once, to account
             // for removing the event from the deferred event queue.
@@ -140,7 +141,7 @@ bool QActive::recall(QEQueue * const eq) noexcept {
             QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool Id & ref Count
         QS_END_NOCRIT_PRE_()
 
-        QF_CRIT_X_();
+        QF_EVT_CRIT_X_(e);
         recalled = true;
     }
     else {
@@ -44,6 +44,31 @@ namespace {
 
 Q_DEFINE_THIS_MODULE("qf_dyn")
 
+#ifdef QF_EPOOL_CACHE
+
+#if (defined QXK_HPP) || (defined Q_UTEST) || (defined QF_ISR_API)
+    #error "QF_EPOOL_CACHE is not supported with QXK, QUTest, or QF_ISR_API"
+#endif
+
+//! the per-thread caches in front of the QF event pools
+struct EPoolCaches {
+    QP::QMPoolCache cache[QF_MAX_EPOOL];
+
+    ~EPoolCaches() { // return the cached blocks when the thread exits
+        for (std::uint_fast8_t idx = 0U; idx < QP::QF_maxPool_; ++idx) {
+            QP::QF_pool_[idx].flushCache_(cache[idx], 0U);
+        }
+    }
+};
+
+thread_local EPoolCaches l_epoolCaches;
+
+#endif // QF_EPOOL_CACHE
+
+//! the maximum number of events handled in one batch of QF::newN_()
+//! and QF::gcN()
+constexpr std::uint_fast16_t EVT_BATCH = 32U;
+
 } // unnamed namespace
 
 namespace QP {
@@ -51,6 +76,12 @@ namespace QP {
 // Package-scope objects *****************************************************
 QF_EPOOL_TYPE_ QF_pool_[QF_MAX_EPOOL]; // allocate the event pools
 std::uint_fast8_t QF_maxPool_; // number of initialized event pools
+std::uint8_t QF_poolLut_[QF_EPOOL_LUT_SIZE]; // event-size to pool lookup
+#ifdef QF_MAX_BUFPOOL
+QF_EPOOL_TYPE_ QF_bufPool_[QF_MAX_BUFPOOL]; // the payload-buffer pools
+std::uint_fast8_t QF_maxBufPool_; // number of initialized buffer pools
+QF_EPOOL_TYPE_ QF_bufEvtPool_; // the pool of buffer events
+#endif
 
 //============================================================================
 //! @description
@@ -94,6 +125,18 @@ void QF::poolInit(void * const poolSto,
     QF_EPOOL_INIT_(QF_pool_[QF_maxPool_], poolSto, poolSize, evtSize);
     ++QF_maxPool_; // one more pool
 
+    // rebuild the event-size to pool lookup table (see QF_poolFind_())
+    std::uint_fast8_t idx = 0U;
+    for (std::uint_fast16_t cls = 0U; cls < QF_EPOOL_LUT_SIZE; ++cls) {
+        while ((idx < QF_maxPool_)
+               && ((cls * QF_EPOOL_LUT_GRAN)
+                   > QF_EPOOL_EVENT_SIZE_(QF_pool_[idx])))
+        {
+            ++idx;
+        }
+        QF_poolLut_[cls] = static_cast<std::uint8_t>(idx);
+    }
+
 #ifdef Q_SPY
     // generate the object-dictionary entry for the initialized pool
     char obj_name[9] = "EvtPool?";
@@ -107,6 +150,9 @@ void QF::poolInit(void * const poolSto,
 //============================================================================
 //! @description
 //! Allocates an event dynamically from one of the QF event pools.
+//! The pool is selected with the event-size lookup table built by
+//! QP::QF::poolInit(), so the allocation time does not depend on the
+//! number of event pools.
 //!
 //! @param[in] evtSize the size (in bytes) of the event to allocate
 //! @param[in] margin  the number of un-allocated events still available
@@ -133,21 +179,21 @@ void QF::poolInit(void * const poolSto,
 QEvt *QF::newX_(std::uint_fast16_t const evtSize,
                 std::uint_fast16_t const margin, enum_t const sig) noexcept
 {
-    std::uint_fast8_t idx;
-
     // find the pool id that fits the requested event size ...
-    for (idx = 0U; idx < QF_maxPool_; ++idx) {
-        if (evtSize <= QF_EPOOL_EVENT_SIZE_(QF_pool_[idx])) {
-            break;
-        }
-    }
+    std::uint_fast8_t const idx = QF_poolFind_(evtSize);
+
     // cannot run out of registered pools
     Q_ASSERT_ID(310, idx < QF_maxPool_);
 
     // get e -- platform-dependent
     QEvt *e;
 
-#ifdef Q_SPY
+#ifdef QF_EPOOL_CACHE
+    e = static_cast<QEvt *>(QF_pool_[idx].getCached_(
+            l_epoolCaches.cache[idx],
+            ((margin != QF_NO_MARGIN) ? margin : 0U),
+            static_cast<std::uint_fast8_t>(QS_EP_ID) + idx + 1U));
+#elif (defined Q_SPY)
     QF_EPOOL_GET_(QF_pool_[idx], e, ((margin != QF_NO_MARGIN) ? margin : 0U),
                   static_cast<std::uint_fast8_t>(QS_EP_ID) + idx + 1U);
 #else
@@ -213,22 +259,31 @@ void QF::gc(QEvt const * const e) noexcept {
     // is it a dynamic event?
     if (e->poolId_ != 0U) {
         QF_CRIT_STAT_
-        QF_CRIT_E_();
+        QF_EVT_CRIT_E_(e);
+
+#ifdef QF_EVT_REF_ATOMIC
+        // drop the reference atomically
+        std::uint8_t const refCtr = QF_EVT_REF_CTR_RELEASE_(e);
+#else
+        std::uint8_t const refCtr = e->refCtr_;
+#endif
 
         // isn't this the last reference?
-        if (e->refCtr_ > 1U) {
+        if (refCtr > 1U) {
 
             QS_BEGIN_NOCRIT_PRE_(QS_QF_GC_ATTEMPT,
                      static_cast<std::uint_fast8_t>(QS_EP_ID)
                          + static_cast<std::uint_fast8_t>(e->poolId_))
                 QS_TIME_PRE_();        // timestamp
                 QS_SIG_PRE_(e->sig);   // the signal of the event
-                QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool Id & refCtr
+                QS_2U8_PRE_(e->poolId_, refCtr); // pool Id & refCtr
             QS_END_NOCRIT_PRE_()
 
+#ifndef QF_EVT_REF_ATOMIC
             QF_EVT_REF_CTR_DEC_(e); // decrement the ref counter
+#endif
 
-            QF_CRIT_X_();
+            QF_EVT_CRIT_X_(e);
         }
         // this is the last reference to this event, recycle it
         else {
@@ -240,10 +295,17 @@ void QF::gc(QEvt const * const e) noexcept {
                          + static_cast<std::uint_fast8_t>(e->poolId_))
                 QS_TIME_PRE_();        // timestamp
                 QS_SIG_PRE_(e->sig);   // the signal of the event
-                QS_2U8_PRE_(e->poolId_, e->refCtr_);
+                QS_2U8_PRE_(e->poolId_, refCtr);
             QS_END_NOCRIT_PRE_()
 
-            QF_CRIT_X_();
+            QF_EVT_CRIT_X_(e);
+
+#ifdef QF_MAX_BUFPOOL
+            if (e->poolId_ == QF_BUF_EVT_POOL_ID) { // a buffer event?
+                bufEvtRecycle_(e);
+                return;
+            }
+#endif
 
             // pool ID must be in range
             Q_ASSERT_ID(410, idx < QF_maxPool_);
@@ -255,7 +317,13 @@ void QF::gc(QEvt const * const e) noexcept {
             QF_EVT_CONST_CAST_(e)->~QEvt(); // xtor,
 #endif
 
-#ifdef Q_SPY
+#ifdef QF_EPOOL_CACHE
+            // cast 'const' away, which is OK, because it's a pool event
+            QF_pool_[idx].putCached_(l_epoolCaches.cache[idx],
+                     QF_EVT_CONST_CAST_(e),
+                     static_cast<std::uint_fast8_t>(QS_EP_ID)
+                         + static_cast<std::uint_fast8_t>(e->poolId_));
+#elif (defined Q_SPY)
             // cast 'const' away, which is OK, because it's a pool event
             QF_EPOOL_PUT_(QF_pool_[idx], QF_EVT_CONST_CAST_(e),
                      static_cast<std::uint_fast8_t>(QS_EP_ID)
@@ -267,6 +335,500 @@ void QF::gc(QEvt const * const e) noexcept {
     }
 }
 
+//============================================================================
+//! @description
+//! Allocates a batch of events dynamically from one of the QF event pools.
+//! The blocks are obtained from the pool in batches of up to 32 events,
+//! each in a single critical section (see QP::QMPool::getN()).
+//!
+//! @param[out] evts    array of at least @p n event pointers to receive
+//!                     the allocated events
+//! @param[in]  n       the number of events to allocate
+//! @param[in]  evtSize the size (in bytes) of the events to allocate
+//! @param[in]  margin  the number of un-allocated events still available
+//!                     in a given event pool after the allocation completes
+//!                     The special value QP::QF_NO_MARGIN means that this
+//!                     function will assert if not all @p n events can be
+//!                     allocated.
+//! @param[in]  sig     the signal to be assigned to the allocated events
+//!
+//! @returns
+//! the number of allocated events (the first entries of @p evts).
+//!
+//! @note
+//! The application code should not call this function directly.
+//! The only allowed use is thorough the macro Q_NEW_N().
+//!
+std::uint_fast16_t QF::newN_(QEvt * evts[],
+                             std::uint_fast16_t const n,
+                             std::uint_fast16_t const evtSize,
+                             std::uint_fast16_t const margin,
+                             enum_t const sig) noexcept
+{
+    // find the pool id that fits the requested event size ...
+    std::uint_fast8_t const idx = QF_poolFind_(evtSize);
+
+    // cannot run out of registered pools
+    Q_ASSERT_ID(710, idx < QF_maxPool_);
+
+    std::uint_fast8_t const qs_id =
+        static_cast<std::uint_fast8_t>(QS_EP_ID) + idx + 1U;
+    std::uint_fast16_t const m = (margin != QF_NO_MARGIN) ? margin : 0U;
+
+    std::uint_fast16_t nNew = 0U;
+    while (nNew < n) {
+        std::uint_fast16_t nReq = n - nNew;
+        if (nReq > EVT_BATCH) {
+            nReq = EVT_BATCH;
+        }
+
+        void *blocks[EVT_BATCH];
+        std::uint_fast16_t nGot;
+#ifdef QF_EPOOL_CACHE
+        for (nGot = 0U; nGot < nReq; ++nGot) {
+            blocks[nGot] = QF_pool_[idx].getCached_(
+                               l_epoolCaches.cache[idx], m, qs_id);
+            if (blocks[nGot] == nullptr) {
+                break;
+            }
+        }
+#else
+        nGot = QF_EPOOL_GETN_(QF_pool_[idx], &blocks[0], nReq, m, qs_id);
+#endif
+
+        QS_CRIT_STAT_
+        for (std::uint_fast16_t i = 0U; i < nGot; ++i) {
+            QEvt * const e = static_cast<QEvt *>(blocks[i]);
+            e->sig     = static_cast<QSignal>(sig); // set the signal
+            e->poolId_ = static_cast<std::uint8_t>(idx + 1U); // pool ID
+            e->refCtr_ = 0U; // initialize the reference counter to 0
+            evts[nNew + i] = e;
+
+            QS_BEGIN_PRE_(QS_QF_NEW, qs_id)
+                QS_TIME_PRE_();       // timestamp
+                QS_EVS_PRE_(evtSize); // the size of the evt
+                QS_SIG_PRE_(sig);     // the signal of the evt
+            QS_END_PRE_()
+        }
+        nNew += nGot;
+
+        if (nGot < nReq) { // the pool could not provide all events?
+            // This assertion means that the event allocation failed,
+            // and this failure cannot be tolerated (see QF::newX_()).
+            Q_ASSERT_ID(720, margin != QF_NO_MARGIN);
+
+            QS_BEGIN_PRE_(QS_QF_NEW_ATTEMPT, qs_id)
+                QS_TIME_PRE_();       // timestamp
+                QS_EVS_PRE_(evtSize); // the size of the evt
+                QS_SIG_PRE_(sig);     // the signal of the evt
+            QS_END_PRE_()
+
+            break;
+        }
+    }
+    return nNew;
+}
+
+//============================================================================
+//! @description
+//! Recycles a batch of dynamic events, just as calling QP::QF::gc() for
+//! each of them, but the reference counters of the events are decremented
+//! in a single critical section (with the default single QF critical
+//! section) and the events to recycle are returned to their event pools
+//! with one QP::QMPool::putN() per pool. Static events in @p evts are
+//! ignored. The events are processed in batches of up to 32 events.
+//!
+//! @param[in] evts array of @p n pointers to the events to recycle
+//! @param[in] n    the number of events to recycle
+//!
+//! @sa QP::QF::gc()
+//!
+void QF::gcN(QEvt const * const evts[],
+             std::uint_fast16_t const n) noexcept
+{
+    for (std::uint_fast16_t i0 = 0U; i0 < n; i0 += EVT_BATCH) {
+        std::uint_fast16_t nb = n - i0;
+        if (nb > EVT_BATCH) {
+            nb = EVT_BATCH;
+        }
+
+        // decrement the reference counters and collect the events to recycle
+        QEvt *recycle[EVT_BATCH];
+        std::uint_fast16_t nRec = 0U;
+        QF_CRIT_STAT_
+#ifdef QF_EVT_CRIT_GLOBAL_
+        QF_CRIT_E_();
+#endif
+        for (std::uint_fast16_t i = 0U; i < nb; ++i) {
+            QEvt const * const e = evts[i0 + i];
+            if (e->poolId_ != 0U) { // is it a dynamic event?
+#ifndef QF_EVT_CRIT_GLOBAL_
+                QF_EVT_CRIT_E_(e);
+#endif
+#ifdef QF_EVT_REF_ATOMIC
+                // drop the reference atomically
+                std::uint8_t const refCtr = QF_EVT_REF_CTR_RELEASE_(e);
+#else
+                std::uint8_t const refCtr = e->refCtr_;
+#endif
+                // isn't this the last reference?
+                if (refCtr > 1U) {
+
+                    QS_BEGIN_NOCRIT_PRE_(QS_QF_GC_ATTEMPT,
+                             static_cast<std::uint_fast8_t>(QS_EP_ID)
+                                 + static_cast<std::uint_fast8_t>(e->poolId_))
+                        QS_TIME_PRE_();      // timestamp
+                        QS_SIG_PRE_(e->sig); // the signal of the event
+                        QS_2U8_PRE_(e->poolId_, refCtr); // pool Id & ref
+                    QS_END_NOCRIT_PRE_()
+
+#ifndef QF_EVT_REF_ATOMIC
+                    QF_EVT_REF_CTR_DEC_(e); // decrement the ref counter
+#endif
+                }
+                // this is the last reference to this event, recycle it
+                else {
+                    QS_BEGIN_NOCRIT_PRE_(QS_QF_GC,
+                             static_cast<std::uint_fast8_t>(QS_EP_ID)
+                                 + static_cast<std::uint_fast8_t>(e->poolId_))
+                        QS_TIME_PRE_();      // timestamp
+                        QS_SIG_PRE_(e->sig); // the signal of the event
+                        QS_2U8_PRE_(e->poolId_, refCtr);
+                    QS_END_NOCRIT_PRE_()
+
+                    // cast 'const' away, which is OK, because it's a pool evt
+                    recycle[nRec] = QF_EVT_CONST_CAST_(e);
+                    ++nRec;
+                }
+#ifndef QF_EVT_CRIT_GLOBAL_
+                QF_EVT_CRIT_X_(e);
+#endif
+            }
+        }
+#ifdef QF_EVT_CRIT_GLOBAL_
+        QF_CRIT_X_();
+#endif
+
+        // return the collected events to their pools, one pool at a time
+        while (nRec != 0U) {
+            std::uint_fast8_t const poolId = recycle[0]->poolId_;
+
+#ifdef QF_MAX_BUFPOOL
+            if (poolId == QF_BUF_EVT_POOL_ID) { // a buffer event?
+                bufEvtRecycle_(recycle[0]);
+                --nRec;
+                recycle[0] = recycle[nRec];
+                continue;
+            }
+#endif
+
+            // pool ID must be in range
+            Q_ASSERT_ID(810, poolId <= QF_maxPool_);
+
+            void *blocks[EVT_BATCH];
+            std::uint_fast16_t nBlocks = 0U;
+            std::uint_fast16_t nRest = 0U;
+            for (std::uint_fast16_t i = 0U; i < nRec; ++i) {
+                QEvt * const e = recycle[i];
+                if (e->poolId_ == poolId) {
+#ifdef Q_EVT_VIRTUAL
+                    e->~QEvt(); // explicitly exectute the destructor
+#endif
+                    blocks[nBlocks] = e;
+                    ++nBlocks;
+                }
+                else { // keep the events from other pools for later
+                    recycle[nRest] = e;
+                    ++nRest;
+                }
+            }
+            nRec = nRest;
+
+            std::uint_fast8_t const qs_id =
+                static_cast<std::uint_fast8_t>(QS_EP_ID) + poolId;
+#ifdef QF_EPOOL_CACHE
+            for (std::uint_fast16_t i = 0U; i < nBlocks; ++i) {
+                QF_pool_[poolId - 1U].putCached_(
+                    l_epoolCaches.cache[poolId - 1U], blocks[i], qs_id);
+            }
+#else
+            QF_EPOOL_PUTN_(QF_pool_[poolId - 1U], &blocks[0], nBlocks, qs_id);
+#endif
+        }
+    }
+}
+
+#ifdef QF_MAX_BUFPOOL
+//============================================================================
+//! @description
+//! This function initializes the pool of buffer events (QP::QBufEvt),
+//! which must be called exactly once before any buffer event is allocated.
+//!
+//! @param[in] poolSto  pointer to the storage for the pool of buffer events
+//! @param[in] poolSize size of the storage for the pool in bytes
+//!
+//! @usage
+//! @code
+//! static QF_MPOOL_EL(QBufEvt) bufEvtPoolSto[32];
+//! QF::bufEvtPoolInit(bufEvtPoolSto, sizeof(bufEvtPoolSto));
+//! @endcode
+//!
+void QF::bufEvtPoolInit(void * const poolSto,
+                        std::uint_fast32_t const poolSize) noexcept
+{
+    QF_EPOOL_INIT_(QF_bufEvtPool_, poolSto, poolSize, sizeof(QBufEvt));
+
+#ifdef Q_SPY
+    QS::obj_dict_pre_(&QF_bufEvtPool_, "BufEvtPool");
+#endif // Q_SPY
+}
+
+//============================================================================
+//! @description
+//! This function initializes one pool of payload buffers (QP::QBuf) at
+//! a time. As with QP::QF::poolInit(), the pools must be initialized in
+//! the ascending order of the buffer size.
+//!
+//! @param[in] poolSto  pointer to the storage for the buffer pool
+//! @param[in] poolSize size of the storage for the pool in bytes
+//! @param[in] bufSize  the maximum size of the payload data (in bytes),
+//!                     not counting the QP::QBuf header
+//!
+//! @usage
+//! @code
+//! static QF_MPOOL_EL(std::uint8_t[QBuf::hdrSize() + 1536]) framePoolSto[8];
+//! QF::bufPoolInit(framePoolSto, sizeof(framePoolSto), 1536U);
+//! @endcode
+//!
+void QF::bufPoolInit(void * const poolSto,
+                     std::uint_fast32_t const poolSize,
+                     std::uint_fast32_t const bufSize) noexcept
+{
+    //! @pre cannot exceed the number of available buffer pools
+    Q_REQUIRE_ID(900, QF_maxBufPool_ < QF_MAX_BUFPOOL);
+
+    std::uint_fast32_t const blockSize = QBuf::hdrSize() + bufSize;
+
+    //! @pre please initialize buffer pools in ascending order of bufSize
+    //! and the block size must fit the pool
+    Q_REQUIRE_ID(901, ((QF_maxBufPool_ == 0U)
+        || (QF_EPOOL_EVENT_SIZE_(QF_bufPool_[QF_maxBufPool_ - 1U])
+            < blockSize))
+        && (blockSize == static_cast<QMPoolSize>(blockSize)));
+
+    QF_EPOOL_INIT_(QF_bufPool_[QF_maxBufPool_], poolSto, poolSize,
+                   blockSize);
+    ++QF_maxBufPool_; // one more pool
+
+#ifdef Q_SPY
+    // generate the object-dictionary entry for the initialized pool
+    char obj_name[9] = "BufPool?";
+    obj_name[7] = static_cast<char>(
+        static_cast<std::int8_t>('0')
+        + static_cast<std::int8_t>(QF_maxBufPool_));
+    QS::obj_dict_pre_(&QF_bufPool_[QF_maxBufPool_ - 1U], &obj_name[0]);
+#endif // Q_SPY
+}
+
+//============================================================================
+//! @description
+//! Allocates a payload buffer from the first buffer pool that fits @p size.
+//! The new buffer is not referenced by any buffer event.
+//!
+//! @param[in] size   the size of the payload data (in bytes)
+//! @param[in] margin the number of un-allocated buffers still available
+//!                   in the given pool after the allocation completes.
+//!                   The special value QP::QF_NO_MARGIN means that this
+//!                   function will assert if allocation fails.
+//!
+//! @returns
+//! pointer to the new payload buffer. This pointer can be NULL only if
+//! margin!=QF_NO_MARGIN and the buffer cannot be allocated.
+//!
+//! @note
+//! The application code should not call this function directly.
+//! The only allowed use is thorough the macros Q_NEW_BUF() or Q_NEW_BUF_X().
+//!
+QBuf *QF::newBuf_(std::uint_fast32_t const size,
+                  std::uint_fast16_t const margin) noexcept
+{
+    std::uint_fast8_t idx;
+
+    // find the pool that fits the requested buffer size ...
+    for (idx = 0U; idx < QF_maxBufPool_; ++idx) {
+        if ((QBuf::hdrSize() + size)
+            <= QF_EPOOL_EVENT_SIZE_(QF_bufPool_[idx]))
+        {
+            break;
+        }
+    }
+    // cannot run out of registered pools
+    Q_ASSERT_ID(910, idx < QF_maxBufPool_);
+
+    // NOTE: the port-specific QF_EPOOL_GET_() yields QEvt pointers, so the
+    // raw block is re-interpreted as the buffer header here
+    QEvt *blk;
+    QF_EPOOL_GET_(QF_bufPool_[idx], blk,
+                  ((margin != QF_NO_MARGIN) ? margin : 0U),
+                  static_cast<std::uint_fast8_t>(QS_EP_ID)
+                      + QF_BUF_EVT_POOL_ID);
+    QBuf * const buf = reinterpret_cast<QBuf *>(blk);
+
+    if (buf != nullptr) {
+        buf->m_size   = static_cast<std::uint32_t>(size);
+        buf->m_poolId = static_cast<std::uint8_t>(idx + 1U);
+        buf->m_refCtr = 0U; // not referenced by any buffer event yet
+    }
+    else {
+        // the buffer allocation failed and this cannot be tolerated
+        Q_ASSERT_ID(920, margin != QF_NO_MARGIN);
+    }
+    return buf;
+}
+
+//============================================================================
+//! @description
+//! Allocates a buffer event from the pool of buffer events and makes it
+//! reference the payload buffer @p buf.
+//!
+//! @param[in] buf    pointer to the payload buffer to reference
+//! @param[in] margin the number of un-allocated buffer events still
+//!                   available after the allocation completes.
+//!                   The special value QP::QF_NO_MARGIN means that this
+//!                   function will assert if allocation fails.
+//! @param[in] sig    the signal to be assigned to the buffer event
+//!
+//! @returns
+//! pointer to the new buffer event. This pointer can be NULL only if
+//! margin!=QF_NO_MARGIN and the buffer event cannot be allocated, in which
+//! case the payload buffer is not referenced.
+//!
+//! @note
+//! The application code should not call this function directly.
+//! The only allowed use is thorough the macros Q_NEW_BUF_EVT() or
+//! Q_NEW_BUF_EVT_X().
+//!
+QBufEvt *QF::newBufEvt_(QBuf * const buf,
+                        std::uint_fast16_t const margin,
+                        enum_t const sig) noexcept
+{
+    //! @pre the payload buffer must be valid
+    Q_REQUIRE_ID(1000, (buf != nullptr)
+                       && (0U < buf->m_poolId)
+                       && (buf->m_poolId <= QF_maxBufPool_));
+
+    QEvt *blk;
+    QF_EPOOL_GET_(QF_bufEvtPool_, blk,
+                  ((margin != QF_NO_MARGIN) ? margin : 0U),
+                  static_cast<std::uint_fast8_t>(QS_EP_ID)
+                      + QF_BUF_EVT_POOL_ID);
+    QBufEvt * const e = static_cast<QBufEvt *>(blk);
+
+    if (e != nullptr) {
+        e->sig     = static_cast<QSignal>(sig); // set the signal
+        e->poolId_ = QF_BUF_EVT_POOL_ID; // the dedicated pool of buffer evts
+        e->refCtr_ = 0U; // initialize the reference counter to 0
+        e->buf     = buf;
+
+        // one more buffer event references the buffer
+#ifdef QF_EVT_REF_ATOMIC
+        std::uint8_t const refCtr =
+            __atomic_add_fetch(&buf->m_refCtr, 1U, __ATOMIC_RELAXED);
+#else
+        QF_CRIT_STAT_
+        QF_EVT_CRIT_E_(buf);
+        ++buf->m_refCtr;
+        std::uint8_t const refCtr = buf->m_refCtr;
+        QF_EVT_CRIT_X_(buf);
+#endif
+
+        // the buffer reference counter must not overflow
+        Q_ASSERT_ID(1010, refCtr != 0U);
+    }
+
+    QS_CRIT_STAT_
+    if (e != nullptr) {
+        QS_BEGIN_PRE_(QS_QF_NEW,
+                      static_cast<std::uint_fast8_t>(QS_EP_ID)
+                          + QF_BUF_EVT_POOL_ID)
+            QS_TIME_PRE_();               // timestamp
+            QS_EVS_PRE_(sizeof(QBufEvt)); // the size of the evt
+            QS_SIG_PRE_(sig);             // the signal of the evt
+        QS_END_PRE_()
+    }
+    else {
+        // the buffer event allocation failed and this cannot be tolerated
+        Q_ASSERT_ID(1020, margin != QF_NO_MARGIN);
+
+        QS_BEGIN_PRE_(QS_QF_NEW_ATTEMPT,
+                      static_cast<std::uint_fast8_t>(QS_EP_ID)
+                          + QF_BUF_EVT_POOL_ID)
+            QS_TIME_PRE_();               // timestamp
+            QS_EVS_PRE_(sizeof(QBufEvt)); // the size of the evt
+            QS_SIG_PRE_(sig);             // the signal of the evt
+        QS_END_PRE_()
+    }
+    return e;
+}
+
+//============================================================================
+//! @description
+//! Releases one reference to the payload buffer @p buf and recycles the
+//! buffer when no more buffer events reference it. QF calls this function
+//! automatically when it recycles a buffer event. The application needs to
+//! call it only for a buffer that has not been attached to any buffer event.
+//!
+//! @param[in] buf pointer to the payload buffer to recycle
+//!
+void QF::bufGc(QBuf * const buf) noexcept {
+    //! @pre the payload buffer must be valid
+    Q_REQUIRE_ID(1100, (buf != nullptr)
+                       && (0U < buf->m_poolId)
+                       && (buf->m_poolId <= QF_maxBufPool_));
+
+#ifdef QF_EVT_REF_ATOMIC
+    // drop the reference atomically
+    bool const isLast = (QF_refCtrRelease_(&buf->m_refCtr) <= 1U);
+#else
+    QF_CRIT_STAT_
+    QF_EVT_CRIT_E_(buf);
+    bool const isLast = (buf->m_refCtr <= 1U);
+    if (!isLast) {
+        --buf->m_refCtr;
+    }
+    QF_EVT_CRIT_X_(buf);
+#endif
+
+    if (isLast) { // the last reference to this buffer? recycle it
+        QF_EPOOL_PUT_(QF_bufPool_[buf->m_poolId - 1U], buf,
+                      static_cast<std::uint_fast8_t>(QS_EP_ID)
+                          + QF_BUF_EVT_POOL_ID);
+    }
+}
+
+//============================================================================
+//! @description
+//! Recycles the buffer event @p e, for which the last reference has been
+//! garbage-collected, and releases its reference to the payload buffer.
+//!
+void QF::bufEvtRecycle_(QEvt const * const e) noexcept {
+    QBuf * const buf = static_cast<QBufEvt const *>(e)->buf;
+
+#ifdef Q_EVT_VIRTUAL
+    // explicitly exectute the destructor
+    // NOTE: casting 'const' away is legitimate, because it's a pool event
+    QF_EVT_CONST_CAST_(e)->~QEvt(); // xtor,
+#endif
+
+    // cast 'const' away, which is OK, because it's a pool event
+    QF_EPOOL_PUT_(QF_bufEvtPool_, QF_EVT_CONST_CAST_(e),
+                  static_cast<std::uint_fast8_t>(QS_EP_ID)
+                      + QF_BUF_EVT_POOL_ID);
+
+    bufGc(buf); // release the reference to the payload buffer
+}
+#endif // QF_MAX_BUFPOOL
+
 //============================================================================
 //! @description
 //! Creates and returns a new reference to the current event e
@@ -290,7 +852,7 @@ QEvt const *QF::newRef_(QEvt const * const e,
                       && (evtRef == nullptr));
 
     QF_CRIT_STAT_
-    QF_CRIT_E_();
+    QF_EVT_CRIT_E_(e);
 
     QF_EVT_REF_CTR_INC_(e); // increments the ref counter
 
@@ -302,7 +864,7 @@ QEvt const *QF::newRef_(QEvt const * const e,
         QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool Id & ref Count
     QS_END_NOCRIT_PRE_()
 
-    QF_CRIT_X_();
+    QF_EVT_CRIT_X_(e);
 
     return e;
 }
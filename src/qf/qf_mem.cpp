@@ -44,6 +44,23 @@ namespace {
 
 Q_DEFINE_THIS_MODULE("qf_mem")
 
+#ifdef QF_MPOOL_LOCKFREE
+
+//! free block of the lock-free QP::QMPool, linked by the index of the next
+//! free block (1-based, 0 means no next block), see NOTE2
+struct QFreeBlockLF {
+    QP::QMPoolCtr volatile m_next; //!< index of the next free block
+};
+
+//! number of bits in the lower half of the tagged head (the block index)
+constexpr unsigned HEAD_SHIFT = sizeof(QP::QMPoolHead) * 4U;
+
+//! mask of the block index in the tagged head
+constexpr QP::QMPoolHead HEAD_IDX = (static_cast<QP::QMPoolHead>(1U)
+                                     << HEAD_SHIFT) - 1U;
+
+#endif // QF_MPOOL_LOCKFREE
+
 } // unnamed namespace
 
 namespace QP {
@@ -60,7 +77,11 @@ namespace QP {
 QMPool::QMPool(void)
   : m_start(nullptr),
     m_end(nullptr),
+#ifndef QF_MPOOL_LOCKFREE
     m_free_head(nullptr),
+#else
+    m_free_head(0U),
+#endif
     m_blockSize(0U),
     m_nTot(0U),
     m_nFree(0U),
@@ -108,8 +129,6 @@ void QMPool::init(void * const poolSto, std::uint_fast32_t poolSize,
         && (static_cast<std::uint_fast16_t>(blockSize + sizeof(QFreeBlock))
             > blockSize));
 
-    m_free_head = poolSto;
-
     // round up the blockSize to fit an integer number of pointers...
     //start with one
     m_blockSize = static_cast<QMPoolSize>(sizeof(QFreeBlock));
@@ -133,7 +152,7 @@ void QMPool::init(void * const poolSto, std::uint_fast32_t poolSize,
     m_nTot = 1U; // one (the last) block in the pool
 
     // start at the head of the free list
-    QFreeBlock *fb = static_cast<QFreeBlock *>(m_free_head);
+    QFreeBlock *fb = static_cast<QFreeBlock *>(poolSto);
 
     // chain all blocks together in a free-list...
     while (poolSize >= blockSize) {
@@ -149,6 +168,19 @@ void QMPool::init(void * const poolSto, std::uint_fast32_t poolSize,
     m_nMin     = m_nTot;  // the minimum number of free blocks
     m_start    = poolSto; // the original start this pool buffer
     m_end      = fb;      // the last block in this pool
+
+#ifndef QF_MPOOL_LOCKFREE
+    m_free_head = poolSto; // the first block is the head of the free list
+#else
+    // re-link the free blocks by their indices (see NOTE2)
+    std::uint8_t *b = static_cast<std::uint8_t *>(poolSto);
+    for (QMPoolCtr idx = 1U; idx < m_nTot; ++idx) {
+        reinterpret_cast<QFreeBlockLF *>(b)->m_next = idx + 1U;
+        b = &b[blockSize];
+    }
+    reinterpret_cast<QFreeBlockLF *>(b)->m_next = 0U; // no next block
+    m_free_head = 1U; // the first block at the head, the ABA tag of 0
+#endif
 }
 
 //============================================================================
@@ -174,10 +206,11 @@ void QMPool::put(void * const b, std::uint_fast8_t const qs_id) noexcept {
     //! @pre # free blocks cannot exceed the total # blocks and
     //! the block pointer must be in range to come from this pool.
     //!
+#ifndef QF_MPOOL_LOCKFREE
     Q_REQUIRE_ID(200, (m_nFree < m_nTot)
                       && QF_PTR_RANGE_(b, m_start, m_end));
     QF_CRIT_STAT_
-    QF_CRIT_E_();
+    QF_MPOOL_CRIT_E_(this);
     static_cast<QFreeBlock*>(b)->m_next =
         static_cast<QFreeBlock *>(m_free_head); // link into the free list
     m_free_head = b; // set as new head of the free list
@@ -189,7 +222,39 @@ void QMPool::put(void * const b, std::uint_fast8_t const qs_id) noexcept {
         QS_MPC_PRE_(m_nFree); // the number of free blocks in the pool
     QS_END_NOCRIT_PRE_()
 
-    QF_CRIT_X_();
+    QF_MPOOL_CRIT_X_(this);
+
+#else // lock-free QMPool, see NOTE2
+    Q_REQUIRE_ID(200, (__atomic_load_n(&m_nFree, __ATOMIC_RELAXED) < m_nTot)
+                      && QF_PTR_RANGE_(b, m_start, m_end));
+
+    // the index of the block b (1-based)
+    QMPoolCtr const idx = static_cast<QMPoolCtr>(
+        (static_cast<std::uint_fast32_t>(static_cast<std::uint8_t *>(b)
+            - static_cast<std::uint8_t *>(m_start)) / m_blockSize) + 1U);
+
+    // push the block on the free list
+    QMPoolHead head = __atomic_load_n(&m_free_head, __ATOMIC_RELAXED);
+    QMPoolHead next;
+    do {
+        __atomic_store_n(&static_cast<QFreeBlockLF *>(b)->m_next,
+            static_cast<QMPoolCtr>(head & HEAD_IDX), __ATOMIC_RELAXED);
+        next = ((head & ~HEAD_IDX) + (HEAD_IDX + 1U)) // advance the tag
+               | static_cast<QMPoolHead>(idx);
+    } while (!__atomic_compare_exchange_n(&m_free_head, &head, next, true,
+                 __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+    QMPoolCtr const nFree =
+        __atomic_add_fetch(&m_nFree, 1U, __ATOMIC_RELAXED);
+    static_cast<void>(nFree); // unused variable, if Q_SPY not defined
+
+    QS_CRIT_STAT_
+    QS_BEGIN_PRE_(QS_QF_MPOOL_PUT, qs_id)
+        QS_TIME_PRE_();       // timestamp
+        QS_OBJ_PRE_(this);    // this memory pool
+        QS_MPC_PRE_(nFree);   // the number of free blocks in the pool
+    QS_END_PRE_()
+#endif // QF_MPOOL_LOCKFREE
 }
 
 //============================================================================
@@ -226,8 +291,9 @@ void *QMPool::get(std::uint_fast16_t const margin,
 {
     static_cast<void>(qs_id); // unused parameter, if Q_SPY not defined
 
+#ifndef QF_MPOOL_LOCKFREE
     QF_CRIT_STAT_
-    QF_CRIT_E_();
+    QF_MPOOL_CRIT_E_(this);
 
     // have the than margin?
     QFreeBlock *fb;
@@ -235,7 +301,8 @@ void *QMPool::get(std::uint_fast16_t const margin,
         fb = static_cast<QFreeBlock *>(m_free_head);  // get a free block
 
         // the pool has some free blocks, so a free block must be available
-        Q_ASSERT_CRIT_(310, fb != nullptr);
+        Q_ASSERT_IN_CRIT_(310, fb != nullptr,
+                          QF_MPOOL_CRIT_X_(this));
 
         // put volatile to a temporary to avoid UB
         void * const fb_next = fb->m_next;
@@ -244,7 +311,8 @@ void *QMPool::get(std::uint_fast16_t const margin,
         m_nFree = (m_nFree - 1U); // one free block less
         if (m_nFree == 0U) {
             // pool is becoming empty, so the next free block must be NULL
-            Q_ASSERT_CRIT_(320, fb_next == nullptr);
+            Q_ASSERT_IN_CRIT_(320, fb_next == nullptr,
+                              QF_MPOOL_CRIT_X_(this));
 
             m_nMin = 0U;// remember that pool got empty
         }
@@ -254,7 +322,8 @@ void *QMPool::get(std::uint_fast16_t const margin,
             // NOTE: the next free block pointer can fall out of range
             // when the client code writes past the memory block, thus
             // corrupting the next block.
-            Q_ASSERT_CRIT_(330, QF_PTR_RANGE_(fb_next, m_start, m_end));
+            Q_ASSERT_IN_CRIT_(330, QF_PTR_RANGE_(fb_next, m_start, m_end),
+                              QF_MPOOL_CRIT_X_(this));
 
             // is the number of free blocks the new minimum so far?
             if (m_nMin > m_nFree) {
@@ -282,11 +351,541 @@ void *QMPool::get(std::uint_fast16_t const margin,
             QS_MPC_PRE_(margin);   // the requested margin
         QS_END_NOCRIT_PRE_()
     }
-    QF_CRIT_X_();
+    QF_MPOOL_CRIT_X_(this);
 
     return fb; // return the block or NULL pointer to the caller
+
+#else // lock-free QMPool, see NOTE2
+    QS_CRIT_STAT_
+
+    // reserve one free block, if there are more than margin free blocks
+    QMPoolCtr nFree = __atomic_load_n(&m_nFree, __ATOMIC_RELAXED);
+    do {
+        if (nFree <= static_cast<QMPoolCtr>(margin)) {
+            QS_BEGIN_PRE_(QS_QF_MPOOL_GET_ATTEMPT, qs_id)
+                QS_TIME_PRE_();        // timestamp
+                QS_OBJ_PRE_(m_start);  // the memory managed by this pool
+                QS_MPC_PRE_(nFree);    // the # free blocks in the pool
+                QS_MPC_PRE_(margin);   // the requested margin
+            QS_END_PRE_()
+
+            return nullptr;
+        }
+    } while (!__atomic_compare_exchange_n(&m_nFree, &nFree,
+                 static_cast<QMPoolCtr>(nFree - 1U), true,
+                 __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    nFree = static_cast<QMPoolCtr>(nFree - 1U); // one free block less
+
+    // is the number of free blocks the new minimum so far?
+    QMPoolCtr nMin = __atomic_load_n(&m_nMin, __ATOMIC_RELAXED);
+    while ((nMin > nFree)
+           && (!__atomic_compare_exchange_n(&m_nMin, &nMin, nFree, true,
+                    __ATOMIC_RELAXED, __ATOMIC_RELAXED)))
+    {}
+
+    // pop the reserved block from the free list
+    QMPoolHead head = __atomic_load_n(&m_free_head, __ATOMIC_ACQUIRE);
+    QFreeBlockLF *fb;
+    QMPoolCtr fb_next;
+    QMPoolHead next;
+    do {
+        QMPoolCtr const idx = static_cast<QMPoolCtr>(head & HEAD_IDX);
+
+        // a free block has been reserved, so the list cannot be empty
+        Q_ASSERT_ID(360, (0U < idx) && (idx <= m_nTot));
+
+        fb = reinterpret_cast<QFreeBlockLF *>(
+            &static_cast<std::uint8_t *>(m_start)[
+                static_cast<std::uint_fast32_t>(idx - 1U) * m_blockSize]);
+        fb_next = __atomic_load_n(&fb->m_next, __ATOMIC_RELAXED);
+        next = ((head & ~HEAD_IDX) + (HEAD_IDX + 1U)) // advance the tag
+               | static_cast<QMPoolHead>(fb_next);
+    } while (!__atomic_compare_exchange_n(&m_free_head, &head, next, true,
+                 __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE));
+
+    // the next free block must be in range; the index can fall out of
+    // range when the client code writes past the previous memory block
+    Q_ASSERT_ID(370, fb_next <= m_nTot);
+
+    QS_BEGIN_PRE_(QS_QF_MPOOL_GET, qs_id)
+        QS_TIME_PRE_();        // timestamp
+        QS_OBJ_PRE_(this);     // this memory pool
+        QS_MPC_PRE_(nFree);    // # of free blocks in the pool
+        QS_MPC_PRE_(__atomic_load_n(&m_nMin, __ATOMIC_RELAXED)); // min #
+    QS_END_PRE_()
+
+    return fb;
+#endif // QF_MPOOL_LOCKFREE
+}
+
+//============================================================================
+//! @description
+//! The function allocates up to @p n memory blocks from the pool at once,
+//! that is, in a single critical section (or a single compare-and-swap of
+//! the lock-free QMPool).
+//!
+//! @param[out] blocks array of at least @p n pointers to receive the blocks
+//! @param[in]  n      the number of blocks to allocate
+//! @param[in]  margin the minimum number of unused blocks still available
+//!                    in the pool after the allocation.
+//! @param[in]  qs_id  QS-id of this state machine (for QS local filter)
+//!
+//! @returns
+//! The number of blocks allocated (the first entries of @p blocks), which
+//! is less than @p n when the pool has not enough blocks above the margin.
+//!
+//! @note
+//! Every allocated block produces the QS_QF_MPOOL_GET trace record, just as
+//! the block allocated with QP::QMPool::get().
+//!
+//! @sa
+//! QP::QMPool::putN()
+//!
+std::uint_fast16_t QMPool::getN(void * blocks[],
+                                std::uint_fast16_t const n,
+                                std::uint_fast16_t const margin,
+                                std::uint_fast8_t const qs_id) noexcept
+{
+    static_cast<void>(qs_id); // unused parameter, if Q_SPY not defined
+
+#ifndef QF_MPOOL_LOCKFREE
+    QF_CRIT_STAT_
+    QF_MPOOL_CRIT_E_(this);
+
+    // the number of blocks that can be allocated above the margin
+    std::uint_fast16_t nGet = 0U;
+    if (m_nFree > static_cast<QMPoolCtr>(margin)) {
+        nGet = static_cast<std::uint_fast16_t>(m_nFree) - margin;
+        if (nGet > n) {
+            nGet = n;
+        }
+    }
+
+    for (std::uint_fast16_t i = 0U; i < nGet; ++i) {
+        QFreeBlock * const fb = static_cast<QFreeBlock *>(m_free_head);
+
+        // the pool has some free blocks, so a free block must be available
+        Q_ASSERT_IN_CRIT_(510, fb != nullptr,
+                          QF_MPOOL_CRIT_X_(this));
+
+        // put volatile to a temporary to avoid UB
+        void * const fb_next = fb->m_next;
+
+        m_nFree = (m_nFree - 1U); // one free block less
+        if (m_nFree == 0U) {
+            // pool is becoming empty, so the next free block must be NULL
+            Q_ASSERT_IN_CRIT_(520, fb_next == nullptr,
+                              QF_MPOOL_CRIT_X_(this));
+
+            m_nMin = 0U; // remember that pool got empty
+        }
+        else {
+            // pool is not empty, so the next free block must be in range
+            Q_ASSERT_IN_CRIT_(530, QF_PTR_RANGE_(fb_next, m_start, m_end),
+                              QF_MPOOL_CRIT_X_(this));
+
+            // is the number of free blocks the new minimum so far?
+            if (m_nMin > m_nFree) {
+                m_nMin = m_nFree; // remember the minimum so far
+            }
+        }
+
+        m_free_head = fb_next; // set the head to the next free block
+        blocks[i] = fb;
+
+        QS_BEGIN_NOCRIT_PRE_(QS_QF_MPOOL_GET, qs_id)
+            QS_TIME_PRE_();        // timestamp
+            QS_OBJ_PRE_(this);     // this memory pool
+            QS_MPC_PRE_(m_nFree);  // # of free blocks in the pool
+            QS_MPC_PRE_(m_nMin);   // min # free blocks ever in the pool
+        QS_END_NOCRIT_PRE_()
+    }
+
+    // not even a single block available?
+    if ((nGet == 0U) && (n != 0U)) {
+        QS_BEGIN_NOCRIT_PRE_(QS_QF_MPOOL_GET_ATTEMPT, qs_id)
+            QS_TIME_PRE_();        // timestamp
+            QS_OBJ_PRE_(m_start);  // the memory managed by this pool
+            QS_MPC_PRE_(m_nFree);  // the # free blocks in the pool
+            QS_MPC_PRE_(margin);   // the requested margin
+        QS_END_NOCRIT_PRE_()
+    }
+    QF_MPOOL_CRIT_X_(this);
+
+    return nGet;
+
+#else // lock-free QMPool, see NOTE2
+    QS_CRIT_STAT_
+
+    // reserve the blocks that can be allocated above the margin
+    std::uint_fast16_t nGet;
+    QMPoolCtr nFree = __atomic_load_n(&m_nFree, __ATOMIC_RELAXED);
+    do {
+        if ((nFree <= static_cast<QMPoolCtr>(margin)) || (n == 0U)) {
+            if (n != 0U) {
+                QS_BEGIN_PRE_(QS_QF_MPOOL_GET_ATTEMPT, qs_id)
+                    QS_TIME_PRE_();        // timestamp
+                    QS_OBJ_PRE_(m_start);  // the memory managed by the pool
+                    QS_MPC_PRE_(nFree);    // the # free blocks in the pool
+                    QS_MPC_PRE_(margin);   // the requested margin
+                QS_END_PRE_()
+            }
+            return 0U;
+        }
+        nGet = static_cast<std::uint_fast16_t>(nFree) - margin;
+        if (nGet > n) {
+            nGet = n;
+        }
+    } while (!__atomic_compare_exchange_n(&m_nFree, &nFree,
+                 static_cast<QMPoolCtr>(nFree - nGet), true,
+                 __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    nFree = static_cast<QMPoolCtr>(nFree - nGet); // nGet free blocks less
+
+    // is the number of free blocks the new minimum so far?
+    QMPoolCtr nMin = __atomic_load_n(&m_nMin, __ATOMIC_RELAXED);
+    while ((nMin > nFree)
+           && (!__atomic_compare_exchange_n(&m_nMin, &nMin, nFree, true,
+                    __ATOMIC_RELAXED, __ATOMIC_RELAXED)))
+    {}
+
+    // pop the chain of the nGet reserved blocks from the free list
+    QMPoolHead head = __atomic_load_n(&m_free_head, __ATOMIC_ACQUIRE);
+    QMPoolHead next;
+    for (;;) {
+        QMPoolCtr idx = static_cast<QMPoolCtr>(head & HEAD_IDX);
+        std::uint_fast16_t i = 0U;
+        // the chain read from a changing list can be inconsistent,
+        // but then the compare-and-swap below fails anyway
+        while ((i < nGet) && (0U < idx) && (idx <= m_nTot)) {
+            QFreeBlockLF * const fb = reinterpret_cast<QFreeBlockLF *>(
+                &static_cast<std::uint8_t *>(m_start)[
+                    static_cast<std::uint_fast32_t>(idx - 1U) * m_blockSize]);
+            blocks[i] = fb;
+            ++i;
+            idx = __atomic_load_n(&fb->m_next, __ATOMIC_RELAXED);
+        }
+        next = ((head & ~HEAD_IDX) + (HEAD_IDX + 1U)) // advance the tag
+               | static_cast<QMPoolHead>(idx);
+        if (i == nGet) {
+            if (__atomic_compare_exchange_n(&m_free_head, &head, next, true,
+                    __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+            {
+                // the next free block must be in range
+                Q_ASSERT_ID(540, idx <= m_nTot);
+                break;
+            }
+        }
+        else { // inconsistent chain, re-read the head and try again
+            head = __atomic_load_n(&m_free_head, __ATOMIC_ACQUIRE);
+        }
+    }
+
+#ifdef Q_SPY
+    for (std::uint_fast16_t i = 0U; i < nGet; ++i) {
+        QS_BEGIN_PRE_(QS_QF_MPOOL_GET, qs_id)
+            QS_TIME_PRE_();        // timestamp
+            QS_OBJ_PRE_(this);     // this memory pool
+            QS_MPC_PRE_(nFree + (nGet - 1U - i)); // # of free blocks
+            QS_MPC_PRE_(__atomic_load_n(&m_nMin, __ATOMIC_RELAXED)); // min
+        QS_END_PRE_()
+    }
+#endif // Q_SPY
+
+    return nGet;
+#endif // QF_MPOOL_LOCKFREE
 }
 
+//============================================================================
+//! @description
+//! Recycle @p n memory blocks to the fixed block-size memory pool at once,
+//! that is, in a single critical section (or a single compare-and-swap of
+//! the lock-free QMPool).
+//!
+//! @param[in] blocks array of @p n pointers to the blocks being recycled
+//! @param[in] n      the number of blocks to recycle
+//! @param[in] qs_id  QS-id of this state machine (for QS local filter)
+//!
+//! @attention
+//! All recycled blocks must be allocated from the __same__ memory pool
+//! to which they are returned.
+//!
+//! @sa
+//! QP::QMPool::getN()
+//!
+void QMPool::putN(void * const blocks[], std::uint_fast16_t const n,
+                  std::uint_fast8_t const qs_id) noexcept
+{
+    static_cast<void>(qs_id); // unused parameter, if Q_SPY not defined
+
+    if (n == 0U) { // nothing to recycle?
+        return;
+    }
+
+#ifndef QF_MPOOL_LOCKFREE
+    QF_CRIT_STAT_
+    QF_MPOOL_CRIT_E_(this);
+
+    //! @pre # free blocks cannot exceed the total # blocks
+    Q_REQUIRE_IN_CRIT_(600, (static_cast<std::uint_fast32_t>(m_nFree) + n)
+                            <= m_nTot,
+                       QF_MPOOL_CRIT_X_(this));
+
+    for (std::uint_fast16_t i = 0U; i < n; ++i) {
+        //! @pre the block pointer must be in range to come from this pool
+        Q_REQUIRE_IN_CRIT_(610, QF_PTR_RANGE_(blocks[i], m_start, m_end),
+                           QF_MPOOL_CRIT_X_(this));
+
+        static_cast<QFreeBlock*>(blocks[i])->m_next =
+            static_cast<QFreeBlock *>(m_free_head); // link into free list
+        m_free_head = blocks[i]; // set as new head of the free list
+        m_nFree = (m_nFree + 1U); // one more free block in this pool
+
+        QS_BEGIN_NOCRIT_PRE_(QS_QF_MPOOL_PUT, qs_id)
+            QS_TIME_PRE_();       // timestamp
+            QS_OBJ_PRE_(this);    // this memory pool
+            QS_MPC_PRE_(m_nFree); // the number of free blocks in the pool
+        QS_END_NOCRIT_PRE_()
+    }
+
+    QF_MPOOL_CRIT_X_(this);
+
+#else // lock-free QMPool, see NOTE2
+    //! @pre # free blocks cannot exceed the total # blocks
+    Q_REQUIRE_ID(600, (static_cast<std::uint_fast32_t>(
+                          __atomic_load_n(&m_nFree, __ATOMIC_RELAXED)) + n)
+                      <= m_nTot);
+
+    // link the blocks into a chain in the order of the array
+    QMPoolCtr first = 0U; // index of the first block in the chain
+    QFreeBlockLF *last = nullptr; // the last block in the chain
+    for (std::uint_fast16_t i = n; i > 0U; --i) {
+        void * const b = blocks[i - 1U];
+
+        //! @pre the block pointer must be in range to come from this pool
+        Q_REQUIRE_ID(610, QF_PTR_RANGE_(b, m_start, m_end));
+
+        if (last == nullptr) {
+            last = static_cast<QFreeBlockLF *>(b);
+        }
+        else {
+            static_cast<QFreeBlockLF *>(b)->m_next = first;
+        }
+        first = static_cast<QMPoolCtr>(
+            (static_cast<std::uint_fast32_t>(static_cast<std::uint8_t *>(b)
+                - static_cast<std::uint8_t *>(m_start)) / m_blockSize) + 1U);
+    }
+
+    // push the whole chain on the free list
+    QMPoolHead head = __atomic_load_n(&m_free_head, __ATOMIC_RELAXED);
+    QMPoolHead next;
+    do {
+        __atomic_store_n(&last->m_next,
+            static_cast<QMPoolCtr>(head & HEAD_IDX), __ATOMIC_RELAXED);
+        next = ((head & ~HEAD_IDX) + (HEAD_IDX + 1U)) // advance the tag
+               | static_cast<QMPoolHead>(first);
+    } while (!__atomic_compare_exchange_n(&m_free_head, &head, next, true,
+                 __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+    QMPoolCtr const nFree = __atomic_add_fetch(&m_nFree,
+        static_cast<QMPoolCtr>(n), __ATOMIC_RELAXED);
+    static_cast<void>(nFree); // unused variable, if Q_SPY not defined
+
+#ifdef Q_SPY
+    QS_CRIT_STAT_
+    for (std::uint_fast16_t i = 0U; i < n; ++i) {
+        QS_BEGIN_PRE_(QS_QF_MPOOL_PUT, qs_id)
+            QS_TIME_PRE_();       // timestamp
+            QS_OBJ_PRE_(this);    // this memory pool
+            QS_MPC_PRE_(nFree - (n - 1U - i)); // # free blocks in the pool
+        QS_END_PRE_()
+    }
+#endif // Q_SPY
+#endif // QF_MPOOL_LOCKFREE
+}
+
+#ifdef QF_EPOOL_CACHE
+//============================================================================
+//! @description
+//! The function allocates a memory block from the pool through the cache
+//! of the calling thread (see NOTE1). The free block is reserved without
+//! entering the critical section, which is entered only to refill an empty
+//! cache with a batch of blocks from the free list of the pool.
+//!
+//! @param[in,out] cache the cache of the calling thread for this pool
+//! @param[in]     margin the minimum number of unused blocks still
+//!                       available in the pool after the allocation.
+//! @param[in]     qs_id  QS-id of this state machine (for QS local filter)
+//!
+//! @returns
+//! A pointer to a memory block or NULL if no more blocks are available.
+//!
+void *QMPool::getCached_(QMPoolCache &cache,
+                         std::uint_fast16_t const margin,
+                         std::uint_fast8_t const qs_id) noexcept
+{
+    static_cast<void>(qs_id); // unused parameter, if Q_SPY not defined
+    QS_CRIT_STAT_
+
+    // reserve one free block, if there are more than margin free blocks
+    QMPoolCtr nFree = __atomic_load_n(&m_nFree, __ATOMIC_RELAXED);
+    do {
+        if (nFree <= static_cast<QMPoolCtr>(margin)) {
+            QS_BEGIN_PRE_(QS_QF_MPOOL_GET_ATTEMPT, qs_id)
+                QS_TIME_PRE_();        // timestamp
+                QS_OBJ_PRE_(m_start);  // the memory managed by this pool
+                QS_MPC_PRE_(nFree);    // the # free blocks in the pool
+                QS_MPC_PRE_(margin);   // the requested margin
+            QS_END_PRE_()
+
+            return nullptr;
+        }
+    } while (!__atomic_compare_exchange_n(&m_nFree, &nFree,
+                 static_cast<QMPoolCtr>(nFree - 1U), true,
+                 __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    nFree = static_cast<QMPoolCtr>(nFree - 1U); // one free block less
+
+    // is the number of free blocks the new minimum so far?
+    QMPoolCtr nMin = __atomic_load_n(&m_nMin, __ATOMIC_RELAXED);
+    while ((nMin > nFree)
+           && (!__atomic_compare_exchange_n(&m_nMin, &nMin, nFree, true,
+                    __ATOMIC_RELAXED, __ATOMIC_RELAXED)))
+    {}
+
+    // cache empty? refill it with a batch of blocks from the free list
+    if (cache.m_nBlocks == 0U) {
+        QF_CRIT_STAT_
+        QF_MPOOL_CRIT_E_(this);
+        QFreeBlock *fb = static_cast<QFreeBlock *>(m_free_head);
+        if (fb != nullptr) {
+            cache.m_head    = fb;
+            cache.m_nBlocks = 1U;
+            while ((cache.m_nBlocks < (QF_EPOOL_CACHE / 2U))
+                   && (fb->m_next != nullptr))
+            {
+                // the next free block must be in range (see QMPool::get())
+                Q_ASSERT_IN_CRIT_(340,
+                    QF_PTR_RANGE_(fb->m_next, m_start, m_end),
+                                  QF_MPOOL_CRIT_X_(this));
+                fb = fb->m_next;
+                ++cache.m_nBlocks;
+            }
+            m_free_head = fb->m_next; // unlink the batch from the free list
+            fb->m_next  = nullptr;    // terminate the cached chain
+        }
+        QF_MPOOL_CRIT_X_(this);
+
+        // all free blocks held in the caches of other threads?
+        if (cache.m_nBlocks == 0U) {
+            nFree = __atomic_add_fetch(&m_nFree, 1U, __ATOMIC_RELAXED);
+
+            QS_BEGIN_PRE_(QS_QF_MPOOL_GET_ATTEMPT, qs_id)
+                QS_TIME_PRE_();        // timestamp
+                QS_OBJ_PRE_(m_start);  // the memory managed by this pool
+                QS_MPC_PRE_(nFree);    // the # free blocks in the pool
+                QS_MPC_PRE_(margin);   // the requested margin
+            QS_END_PRE_()
+
+            return nullptr;
+        }
+    }
+
+    QFreeBlock * const fb = static_cast<QFreeBlock *>(cache.m_head);
+    cache.m_head = fb->m_next; // unlink the block from the cache
+    cache.m_nBlocks = static_cast<QMPoolCtr>(cache.m_nBlocks - 1U);
+
+    QS_BEGIN_PRE_(QS_QF_MPOOL_GET, qs_id)
+        QS_TIME_PRE_();        // timestamp
+        QS_OBJ_PRE_(this);     // this memory pool
+        QS_MPC_PRE_(nFree);    // # of free blocks in the pool
+        QS_MPC_PRE_(__atomic_load_n(&m_nMin, __ATOMIC_RELAXED)); // min #
+    QS_END_PRE_()
+
+    return fb;
+}
+
+//============================================================================
+//! @description
+//! Recycle a memory block to the fixed block-size memory pool through the
+//! cache of the calling thread (see NOTE1). The critical section of the
+//! pool is entered only when the cache overflows and half of its capacity
+//! is returned to the free list of the pool.
+//!
+//! @param[in,out] cache the cache of the calling thread for this pool
+//! @param[in]     b     pointer to the memory block that is being recycled
+//! @param[in]     qs_id QS-id of this state machine (for QS local filter)
+//!
+void QMPool::putCached_(QMPoolCache &cache, void * const b,
+                        std::uint_fast8_t const qs_id) noexcept
+{
+    static_cast<void>(qs_id); // unused parameter, if Q_SPY not defined
+
+    //! @pre the block pointer must be in range to come from this pool
+    Q_REQUIRE_ID(210, QF_PTR_RANGE_(b, m_start, m_end));
+
+    static_cast<QFreeBlock *>(b)->m_next =
+        static_cast<QFreeBlock *>(cache.m_head); // link into the cache
+    cache.m_head = b;
+    cache.m_nBlocks = static_cast<QMPoolCtr>(cache.m_nBlocks + 1U);
+    if (cache.m_nBlocks > QF_EPOOL_CACHE) { // cache overflow?
+        flushCache_(cache, QF_EPOOL_CACHE / 2U);
+    }
+
+    QMPoolCtr const nFree =
+        __atomic_add_fetch(&m_nFree, 1U, __ATOMIC_RELAXED);
+
+    // # free blocks cannot exceed the total # blocks
+    Q_ASSERT_ID(220, nFree <= m_nTot);
+
+    QS_CRIT_STAT_
+    QS_BEGIN_PRE_(QS_QF_MPOOL_PUT, qs_id)
+        QS_TIME_PRE_();       // timestamp
+        QS_OBJ_PRE_(this);    // this memory pool
+        QS_MPC_PRE_(nFree);   // the number of free blocks in the pool
+    QS_END_PRE_()
+}
+
+//============================================================================
+//! @description
+//! Returns the blocks in the @p cache beyond its first @p keep blocks
+//! back to the free list of the pool. The number of free blocks in the pool
+//! does not change, because it already includes the cached blocks.
+//!
+//! @param[in,out] cache the cache of the calling thread for this pool
+//! @param[in]     keep  the number of blocks to keep in the cache
+//!
+void QMPool::flushCache_(QMPoolCache &cache,
+                         std::uint_fast16_t const keep) noexcept
+{
+    if (cache.m_nBlocks > keep) {
+        // find the first block to return and the tail of the cached chain
+        QFreeBlock *fb = static_cast<QFreeBlock *>(cache.m_head);
+        QFreeBlock *last = nullptr; // the last block to keep
+        for (std::uint_fast16_t n = 0U; n < keep; ++n) {
+            last = fb;
+            fb = fb->m_next;
+        }
+        QFreeBlock * const first = fb;
+        while (fb->m_next != nullptr) {
+            fb = fb->m_next;
+        }
+
+        if (last != nullptr) {
+            last->m_next = nullptr; // terminate the kept chain
+        }
+        else {
+            cache.m_head = nullptr; // nothing kept
+        }
+        cache.m_nBlocks = static_cast<QMPoolCtr>(keep);
+
+        QF_CRIT_STAT_
+        QF_MPOOL_CRIT_E_(this);
+        fb->m_next = static_cast<QFreeBlock *>(m_free_head); // splice chain
+        m_free_head = first;
+        QF_MPOOL_CRIT_X_(this);
+    }
+}
+#endif // QF_EPOOL_CACHE
+
 //============================================================================
 //! @description
 //! This function obtains the minimum number of free blocks in the given
@@ -306,12 +905,42 @@ std::uint_fast16_t QF::getPoolMin(std::uint_fast8_t const poolId) noexcept {
     Q_REQUIRE_ID(400, (QF_maxPool_ <= QF_MAX_EPOOL)
                        && (0U < poolId) && (poolId <= QF_maxPool_));
     QF_CRIT_STAT_
-    QF_CRIT_E_();
+    QF_MPOOL_CRIT_E_(&QF_pool_[poolId - 1U]);
+#if (!defined QF_EPOOL_CACHE) && (!defined QF_MPOOL_LOCKFREE)
     std::uint_fast16_t const min = static_cast<std::uint_fast16_t>(
         QF_pool_[poolId - 1U].m_nMin);
-    QF_CRIT_X_();
+#else
+    std::uint_fast16_t const min = static_cast<std::uint_fast16_t>(
+        __atomic_load_n(&QF_pool_[poolId - 1U].m_nMin, __ATOMIC_RELAXED));
+#endif
+    QF_MPOOL_CRIT_X_(&QF_pool_[poolId - 1U]);
 
     return min;
 }
 
 } // namespace QP
+
+//============================================================================
+// NOTE1:
+// With the per-thread caches (QF_EPOOL_CACHE), the number of free blocks
+// m_nFree counts all blocks not allocated by the application, including
+// the blocks held in the caches, and is updated atomically with every
+// allocation and recycling. This keeps m_nFree and the low watermark m_nMin
+// (reported by QF::getPoolMin()) the same as without the caches. However,
+// a free block held in the cache of one thread is not available to other
+// threads, so an event pool should be sized for QF_EPOOL_CACHE additional
+// blocks per thread that allocates or recycles events.
+//
+// NOTE2:
+// The lock-free QMPool (QF_MPOOL_LOCKFREE) keeps the free blocks in a
+// lock-free stack, whose head holds the 1-based index of the first free
+// block and a version tag, which is advanced by every push and pop to
+// prevent the ABA problem in the compare-and-swap. The number of free blocks
+// m_nFree is reserved before the pop and released after the push, so a
+// reserved block is always available on the stack. The low watermark m_nMin
+// is updated right after the reservation, so it never increases, but under
+// contention it might be recorded in a different order than the actual
+// allocations. The next-index of a block popped concurrently by another
+// thread might be read after the block has been reused, but such a stale
+// value is then always rejected by the compare-and-swap on the version tag.
+//
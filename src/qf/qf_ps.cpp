@@ -45,14 +45,145 @@ namespace {
 
 Q_DEFINE_THIS_MODULE("qf_ps")
 
+#ifdef QF_PS_SPARSE
+
+//! entry of the compact subscriber table (see NOTE2)
+struct QSubscrEntry {
+    QP::QSignal sig;         //!< subscribed signal (0 for a free entry)
+    QP::QSubscrList list;    //!< subscribers of the signal
+};
+
+static QSubscrEntry l_psTable[QF_PS_SPARSE]; //!< compact subscriber table
+static std::uint_fast16_t l_psUsed;          //!< # used entries in the table
+static QP::QSubscrList const l_psNone = {};  //!< the empty subscriber list
+
+//! the "home" entry of the signal @p sig (Fibonacci hashing)
+static inline std::uint_fast16_t psHome(QP::QSignal const sig) noexcept {
+    return static_cast<std::uint_fast16_t>(
+        ((static_cast<std::uint32_t>(sig) * 2654435769U) >> 16U)
+        & (QF_PS_SPARSE - 1U));
+}
+
+//! the entry of the signal @p sig or the free entry ending its probe chain
+static std::uint_fast16_t psFind(QP::QSignal const sig) noexcept {
+    std::uint_fast16_t i = psHome(sig);
+    std::uint_fast16_t n = QF_PS_SPARSE; // bound for torn reads, see NOTE3
+    while ((l_psTable[i].sig != sig) && (l_psTable[i].sig != 0U)
+           && (n != 0U))
+    {
+        i = (i + 1U) & (QF_PS_SPARSE - 1U); // linear probing
+        --n;
+    }
+    return i;
+}
+
+//! remove the entry @p i without breaking the probe chains of other entries
+static void psRemove(std::uint_fast16_t i) noexcept {
+    std::uint_fast16_t j = i;
+    for (;;) {
+        j = (j + 1U) & (QF_PS_SPARSE - 1U);
+        if (l_psTable[j].sig == 0U) {
+            break; // end of the probe chain
+        }
+        std::uint_fast16_t const k = psHome(l_psTable[j].sig);
+        // can the entry j move back to the vacated entry i?
+        if ((i <= j) ? ((k <= i) || (j < k)) : ((k <= i) && (j < k))) {
+            l_psTable[i] = l_psTable[j];
+            i = j;
+        }
+    }
+    l_psTable[i].sig = 0U;
+    l_psTable[i].list.setEmpty();
+    --l_psUsed;
+}
+
+#endif // QF_PS_SPARSE
+
 } // unnamed namespace
 
+// multicast to all subscribers in a single critical section? (see NOTE1)
+#ifdef QF_PUBLISH_MULTICAST
+    #if (!defined QACTIVE_EQUEUE_SIGNAL_)
+        #error "QF_PUBLISH_MULTICAST requires the native QEQueue in AOs"
+    #elif (!defined QACTIVE_EQUEUE_CRIT_GLOBAL_) \
+          || (!defined QF_PS_CRIT_GLOBAL_)
+        #error "QF_PUBLISH_MULTICAST requires the single QF critical section"
+    #elif (defined QF_EQUEUE_LOCKFREE) || (defined QF_ACTIVE_CONFLATE)
+        #error "QF_PUBLISH_MULTICAST requires the standard QEQueue operations"
+    #elif (defined QXK_HPP) || (defined Q_UTEST)
+        #error "QF_PUBLISH_MULTICAST cannot be used with QXK or QUTest"
+    #endif
+#endif
+
+#ifdef QF_PS_SEQLOCK // lock-free reading of the subscriber lists, see NOTE3
+    //! start modifying the subscriber lists (inside QF_PS_CRIT_E_())
+    #define QF_PS_WRITE_BEGIN_() QF_psWriteBegin_()
+
+    //! finish modifying the subscriber lists (before QF_PS_CRIT_X_())
+    #define QF_PS_WRITE_END_()   QF_psWriteEnd_()
+#else
+    #define QF_PS_WRITE_BEGIN_() static_cast<void>(0)
+    #define QF_PS_WRITE_END_()   static_cast<void>(0)
+#endif
+
 namespace QP {
 
 // Package-scope objects *****************************************************
 QSubscrList *QF_subscrList_;
 enum_t QF_maxPubSignal_;
 
+#ifdef QF_PS_SPARSE
+//............................................................................
+QSubscrList const &QF_psList_(enum_t const sig) noexcept {
+    std::uint_fast16_t const i = psFind(static_cast<QSignal>(sig));
+    return (l_psTable[i].sig == static_cast<QSignal>(sig))
+           ? l_psTable[i].list
+           : l_psNone;
+}
+#endif // QF_PS_SPARSE
+
+#ifdef QF_PS_SEQLOCK
+//! version of the subscriber lists, odd while a writer modifies them
+static std::uint32_t volatile l_psVersion;
+
+//! the number of lock-free attempts to read a consistent subscriber list
+constexpr std::uint_fast8_t PS_READ_TRIES = 16U;
+
+//............................................................................
+//! start modifying the subscriber lists: make the version odd (see NOTE3)
+static inline void QF_psWriteBegin_(void) noexcept {
+    __atomic_store_n(&l_psVersion, l_psVersion + 1U, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE); // version before the lists
+}
+//............................................................................
+//! finish modifying the subscriber lists: publish the new (even) version
+static inline void QF_psWriteEnd_(void) noexcept {
+    __atomic_store_n(&l_psVersion, l_psVersion + 1U, __ATOMIC_RELEASE);
+}
+//............................................................................
+//! consistent copy of the subscriber list of @p sig (see NOTE3)
+static QPSet QF_psRead_(enum_t const sig) noexcept {
+    for (std::uint_fast8_t n = PS_READ_TRIES; n != 0U; --n) {
+        std::uint32_t const ver =
+            __atomic_load_n(&l_psVersion, __ATOMIC_ACQUIRE);
+        if ((ver & 1U) == 0U) { // no writer active?
+            QPSet const subscrList = QF_PS_LIST_(sig);
+            __atomic_thread_fence(__ATOMIC_ACQUIRE); // lists before version
+            if (__atomic_load_n(&l_psVersion, __ATOMIC_RELAXED) == ver) {
+                return subscrList; // no writer interfered
+            }
+        }
+    }
+
+    // the writers keep changing the lists, so wait for them
+    QF_CRIT_STAT_
+    QF_PS_CRIT_E_();
+    QPSet const subscrList = QF_PS_LIST_(sig);
+    QF_PS_CRIT_X_();
+    return subscrList;
+}
+#endif // QF_PS_SEQLOCK
+
 //============================================================================
 //! @description
 //! This function initializes the publish-subscribe facilities of QF and must
@@ -75,6 +206,11 @@ enum_t QF_maxPubSignal_;
 //! choose not to use publish-subscribe. In that case calling QF::psInit()
 //! and using up memory for the subscriber-lists is unnecessary.
 //!
+//! @note
+//! With the compact subscriber table configured (#QF_PS_SPARSE), QF keeps
+//! the subscriber lists internally and @p subscrSto is not used (it can be
+//! nullptr), while @p maxSignal still bounds the published signals.
+//!
 //! @sa
 //! QP::QSubscrList
 //!
@@ -85,13 +221,23 @@ enum_t QF_maxPubSignal_;
 void QF::psInit(QSubscrList * const subscrSto,
                 enum_t const maxSignal) noexcept
 {
-    QF_subscrList_   = subscrSto;
     QF_maxPubSignal_ = maxSignal;
 
+#ifndef QF_PS_SPARSE
+    QF_subscrList_   = subscrSto;
+
     // zero the subscriber list, so that the framework can start correctly
     // even if the startup code fails to clear the uninitialized data
     // (as is required by the C++ Standard)
     bzero(subscrSto, static_cast<unsigned>(maxSignal) * sizeof(QSubscrList));
+#else
+    static_cast<void>(subscrSto); // unused parameter
+    QF_subscrList_   = nullptr;
+
+    // clear the compact subscriber table (see NOTE2)
+    bzero(&l_psTable[0], sizeof(l_psTable));
+    l_psUsed = 0U;
+#endif // QF_PS_SPARSE
 }
 
 //============================================================================
@@ -123,7 +269,8 @@ void QF::publish_(QEvt const * const e,
     Q_REQUIRE_ID(100, static_cast<enum_t>(e->sig) < QF_maxPubSignal_);
 
     QF_CRIT_STAT_
-    QF_CRIT_E_();
+#ifndef QF_PS_SEQLOCK
+    QF_PS_CRIT_E_();
 
     QS_BEGIN_NOCRIT_PRE_(QS_QF_PUBLISH, qs_id)
         QS_TIME_PRE_();                      // the timestamp
@@ -141,12 +288,36 @@ void QF::publish_(QEvt const * const e,
         // recycles the event if the counter drops to zero. This covers the
         // case when the event was published without any subscribers.
         //
+        QF_EVT_REF_LOCK_(e);
         QF_EVT_REF_CTR_INC_(e);
+        QF_EVT_REF_UNLOCK_(e);
     }
 
-    // make a local, modifiable copy of the subscriber list
-    QPSet subscrList = QF_subscrList_[e->sig];
+    // make a local copy of the subscriber list
+    QPSet const subscrList = QF_PS_LIST_(e->sig);
+    QF_PS_CRIT_X_();
+#else // lock-free snapshot of the subscriber list, see NOTE3
+#ifdef Q_SPY
+    QF_CRIT_E_();
+    QS_BEGIN_NOCRIT_PRE_(QS_QF_PUBLISH, qs_id)
+        QS_TIME_PRE_();                      // the timestamp
+        QS_OBJ_PRE_(sender);                 // the sender object
+        QS_SIG_PRE_(e->sig);                 // the signal of the event
+        QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
+    QS_END_NOCRIT_PRE_()
     QF_CRIT_X_();
+#endif // Q_SPY
+
+    // is it a dynamic event? (see the comment above)
+    if (e->poolId_ != 0U) {
+        QF_EVT_CRIT_E_(e);
+        QF_EVT_REF_CTR_INC_(e);
+        QF_EVT_CRIT_X_(e);
+    }
+
+    // make a local copy of the subscriber list
+    QPSet const subscrList = QF_psRead_(e->sig);
+#endif // QF_PS_SEQLOCK
 
     if (subscrList.notEmpty()) { // any subscribers?
         // the highest-prio subscriber
@@ -154,21 +325,90 @@ void QF::publish_(QEvt const * const e,
         QF_SCHED_STAT_
 
         QF_SCHED_LOCK_(p); // lock the scheduler up to prio 'p'
+#ifndef QF_PUBLISH_MULTICAST
         do { // loop over all subscribers */
+            QActive * const a = active_[p];
+
+            // the prio of the AO must be registered with the framework
+            Q_ASSERT_ID(210, a != nullptr);
+
+            if (QF_PS_ACCEPTS_(a, e)) { // not filtered out? (see NOTE4)
+                // POST() asserts internally if the queue overflows
+                static_cast<void>(a->POST(e, sender));
+            }
+
+            p = subscrList.findMaxBelow(p); // the next subscriber, if any
+        } while (p != 0U);
+#else // batched multicast, see NOTE1
+#ifdef QF_PS_FILTER
+        // evaluate the filters outside the critical section (see NOTE4)
+        QPSet accepted = subscrList;
+        do {
             // the prio of the AO must be registered with the framework
             Q_ASSERT_ID(210, active_[p] != nullptr);
 
-            // POST() asserts internally if the queue overflows
-            static_cast<void>(active_[p]->POST(e, sender));
+            if (!active_[p]->psAccepts_(e)) { // filtered out?
+                accepted.rmove(p);
+            }
+            p = subscrList.findMaxBelow(p); // the next subscriber, if any
+        } while (p != 0U);
+        p = accepted.findMax(); // zero if all subscribers filtered it out
+#else
+        QPSet const &accepted = subscrList;
+#endif // QF_PS_FILTER
+
+        QF_CRIT_E_();
+        while (p != 0U) { // loop over all accepted subscribers
+            QActive * const a = active_[p];
+
+            // the prio of the AO must be registered with the framework
+            Q_ASSERT_CRIT_(210, a != nullptr);
+
+            // the event must be delivered (as with POST())
+            QEQueueCtr nFree = a->m_eQueue.m_nFree; // temporary for volatile
+            Q_ASSERT_CRIT_(220, nFree != 0U);
 
-            subscrList.rmove(p); // remove the handled subscriber
-            if (subscrList.notEmpty()) {  // still more subscribers?
-                p = subscrList.findMax(); // the highest-prio subscriber
+            --nFree;  // one free entry just used up
+            a->m_eQueue.m_nFree = nFree; // update the volatile
+            if (a->m_eQueue.m_nMin > nFree) {
+                a->m_eQueue.m_nMin = nFree; // update minimum so far
+            }
+            if (e->poolId_ != 0U) { // is it a dynamic event?
+                QF_EVT_REF_CTR_INC_(e); // increment the reference counter
             }
+
+            QS_BEGIN_NOCRIT_PRE_(QS_QF_ACTIVE_POST, p)
+                QS_TIME_PRE_();               // timestamp
+                QS_OBJ_PRE_(sender);          // the sender object
+                QS_SIG_PRE_(e->sig);          // the signal of the event
+                QS_OBJ_PRE_(a);               // the subscriber AO
+                QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool-Id & ref-ctr
+                QS_EQC_PRE_(nFree);           // number of free entries
+                QS_EQC_PRE_(a->m_eQueue.m_nMin); // min number of free
+            QS_END_NOCRIT_PRE_()
+
+            // empty queue?
+            if (a->m_eQueue.m_frontEvt == nullptr) {
+                a->m_eQueue.m_frontEvt = e; // deliver event directly
+                QACTIVE_EQUEUE_SIGNAL_(a);  // signal the event queue
+            }
+            // queue is not empty, insert event into the ring-buffer
             else {
-                p = 0U; // no more subscribers
+                // insert event pointer e into the buffer (FIFO)
+                a->m_eQueue.m_ring[a->m_eQueue.m_head] = e;
+
+                // need to wrap head?
+                if (a->m_eQueue.m_head == 0U) {
+                    a->m_eQueue.m_head = a->m_eQueue.m_end; // wrap around
+                }
+                // advance the head (counter clockwise)
+                a->m_eQueue.m_head = (a->m_eQueue.m_head - 1U);
             }
-        } while (p != 0U);
+
+            p = accepted.findMaxBelow(p); // the next subscriber, if any
+        }
+        QF_CRIT_X_();
+#endif // QF_PUBLISH_MULTICAST
         QF_SCHED_UNLOCK_(); // unlock the scheduler
     }
 
@@ -206,7 +446,7 @@ void QActive::subscribe(enum_t const sig) const noexcept {
               && (QF::active_[p] == this));
 
     QF_CRIT_STAT_
-    QF_CRIT_E_();
+    QF_PS_CRIT_E_();
 
     QS_BEGIN_NOCRIT_PRE_(QS_QF_ACTIVE_SUBSCRIBE, m_prio)
         QS_TIME_PRE_();    // timestamp
@@ -214,8 +454,23 @@ void QActive::subscribe(enum_t const sig) const noexcept {
         QS_OBJ_PRE_(this); // this active object
     QS_END_NOCRIT_PRE_()
 
+    QF_PS_WRITE_BEGIN_();
+#ifndef QF_PS_SPARSE
     QF_subscrList_[sig].insert(p); // insert into subscriber-list
-    QF_CRIT_X_();
+#else
+    std::uint_fast16_t const i = psFind(static_cast<QSignal>(sig));
+    if (l_psTable[i].sig == 0U) { // the first subscriber of the signal?
+        //! @pre the compact subscriber table must not overflow
+        // (one entry must always stay free to terminate the probe chains)
+        Q_REQUIRE_IN_CRIT_(310, l_psUsed < (QF_PS_SPARSE - 1U),
+                           QF_PS_CRIT_X_());
+        l_psTable[i].sig = static_cast<QSignal>(sig);
+        ++l_psUsed;
+    }
+    l_psTable[i].list.insert(p); // insert into subscriber-list
+#endif // QF_PS_SPARSE
+    QF_PS_WRITE_END_();
+    QF_PS_CRIT_X_();
 }
 
 //============================================================================
@@ -253,7 +508,7 @@ void QActive::unsubscribe(enum_t const sig) const noexcept {
                       && (QF::active_[p] == this));
 
     QF_CRIT_STAT_
-    QF_CRIT_E_();
+    QF_PS_CRIT_E_();
 
     QS_BEGIN_NOCRIT_PRE_(QS_QF_ACTIVE_UNSUBSCRIBE, m_prio)
         QS_TIME_PRE_();         // timestamp
@@ -261,10 +516,60 @@ void QActive::unsubscribe(enum_t const sig) const noexcept {
         QS_OBJ_PRE_(this);      // this active object
     QS_END_NOCRIT_PRE_()
 
+    QF_PS_WRITE_BEGIN_();
+#ifndef QF_PS_SPARSE
     QF_subscrList_[sig].rmove(p); // remove from subscriber-list
+#else
+    std::uint_fast16_t const i = psFind(static_cast<QSignal>(sig));
+    if (l_psTable[i].sig != 0U) {
+        l_psTable[i].list.rmove(p); // remove from subscriber-list
+        if (l_psTable[i].list.isEmpty()) { // no more subscribers?
+            psRemove(i); // free the entry for other signals
+        }
+    }
+#endif // QF_PS_SPARSE
+    QF_PS_WRITE_END_();
 
-    QF_CRIT_X_();
+    QF_PS_CRIT_X_();
+}
+
+#ifdef QF_PS_FILTER
+//============================================================================
+//! @description
+//! This function sets the publish filter of the active object.
+//! QF::publish_() calls the filter for every event published to the active
+//! object (for all its subscribed signals) and posts the event only when
+//! the filter returns 'true'. This saves the event-queue entry, the
+//! reference counting, and the dispatching of the events that the active
+//! object would ignore anyway.
+//!
+//! @param[in] filter the publish filter of the active object
+//!                   (nullptr to remove the filter)
+//!
+//! @note
+//! An active object has only one filter, which applies to all signals and
+//! is replaced by every call to this function. The filter must return
+//! 'true' for the signals that it does not filter. Un-subscribing (also
+//! with QP::QActive::unsubscribeAll()) leaves the filter in place, and only
+//! setPublishFilter(nullptr) removes it.
+//!
+//! @attention
+//! The filter is called in the context of the publisher, outside of any
+//! critical section, but with the scheduler locked (see NOTE4). It must be
+//! fast, must not modify anything, and must not call any QF services.
+//!
+//! @usage
+//! The following example shows a per-channel active object, which receives
+//! only the published events of its own channel:
+//! @include qf_subscribe_filter.cpp
+//!
+void QActive::setPublishFilter(QSubscrFilter const filter) noexcept {
+    QF_CRIT_STAT_
+    QF_PS_CRIT_E_();
+    m_psFilter = filter;
+    QF_PS_CRIT_X_();
 }
+#endif // QF_PS_FILTER
 
 //============================================================================
 //! @description
@@ -293,9 +598,10 @@ void QActive::unsubscribeAll(void) const noexcept {
     Q_REQUIRE_ID(500, (0U < p) && (p <= QF_MAX_ACTIVE)
                       && (QF::active_[p] == this));
 
+#if (!defined QF_PS_SPARSE) && (!defined QF_PS_SEQLOCK)
     for (enum_t sig = Q_USER_SIG; sig < QF_maxPubSignal_; ++sig) {
         QF_CRIT_STAT_
-        QF_CRIT_E_();
+        QF_PS_CRIT_E_();
         if (QF_subscrList_[sig].hasElement(p)) {
             QF_subscrList_[sig].rmove(p);
 
@@ -306,11 +612,117 @@ void QActive::unsubscribeAll(void) const noexcept {
             QS_END_NOCRIT_PRE_()
 
         }
-        QF_CRIT_X_();
+        QF_PS_CRIT_X_();
 
         // prevent merging critical sections
         QF_CRIT_EXIT_NOP();
     }
+#else // single bulk update, see NOTE2 and NOTE3
+    QF_CRIT_STAT_
+    QF_PS_CRIT_E_();
+    QF_PS_WRITE_BEGIN_();
+#ifndef QF_PS_SPARSE
+    for (enum_t sig = Q_USER_SIG; sig < QF_maxPubSignal_; ++sig) {
+        if (QF_subscrList_[sig].hasElement(p)) {
+            QF_subscrList_[sig].rmove(p);
+
+            QS_BEGIN_NOCRIT_PRE_(QS_QF_ACTIVE_UNSUBSCRIBE, m_prio)
+                QS_TIME_PRE_();     // timestamp
+                QS_SIG_PRE_(sig);   // the signal of this event
+                QS_OBJ_PRE_(this);  // this active object
+            QS_END_NOCRIT_PRE_()
+        }
+    }
+#else // the whole table in one critical section, see NOTE2
+    std::uint_fast16_t i = 0U;
+    while (i < QF_PS_SPARSE) {
+        if ((l_psTable[i].sig != 0U) && l_psTable[i].list.hasElement(p)) {
+            QS_BEGIN_NOCRIT_PRE_(QS_QF_ACTIVE_UNSUBSCRIBE, m_prio)
+                QS_TIME_PRE_();                // timestamp
+                QS_SIG_PRE_(l_psTable[i].sig); // the signal of this event
+                QS_OBJ_PRE_(this);             // this active object
+            QS_END_NOCRIT_PRE_()
+
+            l_psTable[i].list.rmove(p);
+            if (l_psTable[i].list.isEmpty()) { // no more subscribers?
+                psRemove(i); // entry i might now hold another signal
+                continue;    // so check entry i again
+            }
+        }
+        ++i;
+    }
+#endif // QF_PS_SPARSE
+    QF_PS_WRITE_END_();
+    QF_PS_CRIT_X_();
+#endif // QF_PS_SPARSE || QF_PS_SEQLOCK
 }
 
 } // namespace QP
+
+//============================================================================
+// NOTE1:
+// Defining the macro QF_PUBLISH_MULTICAST (in qf_port.hpp or on the command
+// line) makes QF::publish_() insert the event into the queues of all
+// subscribers within one QF critical section, instead of calling POST()
+// for every subscriber. The subscribers are still served in the order of
+// their priorities and every insertion produces the usual QS_QF_ACTIVE_POST
+// trace record, but the critical section is entered only once for the whole
+// multicast instead of once per subscriber. The option is off by default:
+// - the event queues of all subscribers must be the native QEQueue,
+//   protected by the single QF critical section (#error otherwise), and
+//   a QTicker must not subscribe to events;
+// - the virtual QActive::post_() is bypassed, so the option cannot be used
+//   with QXK or QUTest (#error) nor with any AO class overriding post_();
+// - the critical section lasts for the whole fan-out, so the interrupt
+//   latency (in QV/QK) grows with the number of subscribers.
+//
+// NOTE2:
+// The compact subscriber table (#QF_PS_SPARSE) is an open-addressing hash
+// table with linear probing, keyed by the signal. An entry is allocated by
+// the first subscribe() to a signal and freed by the last unsubscribe(),
+// so the RAM scales with the number of subscribed signals rather than with
+// the range of signals. The table is modified only inside the QF_PS critical
+// section and QF::publish_() looks up the signal inside the same critical
+// section, so the lookup always sees a consistent table. With the table at
+// most (QF_PS_SPARSE - 1) full, the lookup visits on average only a few
+// entries (the signals of an application are typically consecutive, which
+// the Fibonacci hash spreads evenly over the table). The freed entries are
+// filled by moving back the following entries of the probe chain, instead
+// of leaving "tombstones", so the lookups don't degrade over time.
+// Because the removal can move entries, unsubscribeAll() scans the whole
+// table in a single critical section, which is bounded by QF_PS_SPARSE.
+//
+// NOTE3:
+// With the macro QF_PS_SEQLOCK defined, QF::publish_() copies the subscriber
+// list without entering QF_PS_CRIT_E_(), so that publishing (which is far
+// more frequent than subscribing) does not contend for the lock of the
+// subscriber lists with other publishers or with the writers. Instead, the
+// writers publish a new version of the subscriber lists: the version is odd
+// while a writer modifies the lists and is even otherwise. A publisher
+// accepts its copy only when the version was even and did not change during
+// the copy. Otherwise, it copies the list again, and after PS_READ_TRIES
+// failed attempts it takes the lock, which bounds the time of a publisher
+// racing with a stream of writers. The writers still serialize in the
+// critical section. QActive::unsubscribeAll() is then a single bulk update
+// (one critical section and one new version for all signals), whose length
+// is proportional to the number of signals (or to #QF_PS_SPARSE).
+// The option requires the GCC-style __atomic builtins. It pays off on
+// multi-core hosts (e.g., the POSIX port with QF_FINE_LOCKS, where the
+// subscriber lists have a dedicated mutex). With the compact subscriber
+// table (NOTE2), a lookup racing with a writer might see a torn table, so
+// the probing is bounded by QF_PS_SPARSE entries and the result is then
+// discarded by the version check.
+//
+// NOTE4:
+// With the macro QF_PS_FILTER defined, every active object can have one
+// publish filter (see QActive::setPublishFilter()), which QF::publish_()
+// evaluates for the AO before posting a published event to it. An event
+// rejected by the filter takes no entry in the AO's event queue, no
+// reference and no dispatch, so filtering by the content of the event
+// (e.g., a channel number) costs only the call of the filter. The filter is
+// always called outside of any critical section (in the batched multicast
+// (NOTE1) all filters are evaluated before the critical section is
+// entered), but with the scheduler locked, so it must be short and must not
+// call any QF services. The filters are evaluated for every published
+// event, so the option adds one test per subscriber even for the active
+// objects without a filter.
@@ -37,6 +37,12 @@ namespace QP {
 QActive::QActive(QStateHandler const initial) noexcept
   : QHsm(initial),
     m_prio(0U)
+#ifdef QF_ACTIVE_BATCH
+    , m_batch(QF_ACTIVE_BATCH)
+#endif
+#ifdef QF_PS_FILTER
+    , m_psFilter(nullptr)
+#endif
 {
 #ifdef QF_OS_OBJECT_TYPE
     QF::bzero(&m_osObject, sizeof(m_osObject));
@@ -45,6 +51,10 @@ QActive::QActive(QStateHandler const initial) noexcept
 #ifdef QF_THREAD_TYPE
     QF::bzero(&m_thread, sizeof(m_thread));
 #endif
+
+#ifdef QF_ACTIVE_CONFLATE
+    QF::bzero(&m_conflate[0], sizeof(m_conflate)); // no conflated signals
+#endif
 }
 
 } // namespace QP
@@ -134,7 +134,9 @@ bool QEQueue::post(QEvt const * const e,
     {
         // is it a dynamic event?
         if (e->poolId_ != 0U) {
+            QF_EVT_REF_LOCK_(e);
             QF_EVT_REF_CTR_INC_(e); // increment the reference counter
+            QF_EVT_REF_UNLOCK_(e);
         }
 
         --nFree; // one free entry just used up
@@ -228,7 +230,9 @@ void QEQueue::postLIFO(QEvt const * const e,
 
     // is it a dynamic event?
     if (e->poolId_ != 0U) {
+        QF_EVT_REF_LOCK_(e);
         QF_EVT_REF_CTR_INC_(e); // increment the reference counter
+        QF_EVT_REF_UNLOCK_(e);
     }
 
     --nFree; // one free entry just used up
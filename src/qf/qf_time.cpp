@@ -46,11 +46,28 @@ Q_DEFINE_THIS_MODULE("qf_time")
 
 } // unnamed namespace
 
+#if (defined QF_TIMEEVT_WHEEL) && (defined QXK_HPP)
+    #error "QF_TIMEEVT_WHEEL is not supported in the QXK kernel"
+#endif
+#if (defined QF_TIMEEVT_WHEEL) && (defined Q_UTEST)
+    #error "QF_TIMEEVT_WHEEL is not supported in QUTest"
+#endif
+
 namespace QP {
 
 // Package-scope objects *****************************************************
 QTimeEvt QF::timeEvtHead_[QF_MAX_TICK_RATE]; // heads of time event lists
 
+#ifdef QF_TIMEEVT_WHEEL
+// timing wheels (see NOTE2)
+QTimeEvt * volatile QF::timeEvtWheel_[QF_MAX_TICK_RATE][QF_TIMEEVT_WHEEL];
+
+//! the wheel slot of the time events expiring at the tick @p when_
+#define QF_TIMEEVT_SLOT_(tickRate_, when_) \
+    (&QF::timeEvtWheel_[(tickRate_)][ \
+        static_cast<QTimeEvtCtr>(when_) & (QF_TIMEEVT_WHEEL - 1U)])
+#endif // QF_TIMEEVT_WHEEL
+
 #ifdef Q_SPY
 //============================================================================
 //! @description
@@ -78,10 +95,11 @@ void QF::tickX_(std::uint_fast8_t const tickRate,
 void QF::tickX_(std::uint_fast8_t const tickRate) noexcept
 #endif
 {
+#ifndef QF_TIMEEVT_WHEEL
     QTimeEvt *prev = &timeEvtHead_[tickRate];
 
     QF_CRIT_STAT_
-    QF_CRIT_E_();
+    QF_TIMEEVT_CRIT_E_(tickRate);
 
     QS_BEGIN_NOCRIT_PRE_(QS_QF_TICK, 0U)
         prev->m_ctr = (prev->m_ctr + 1U);
@@ -100,7 +118,8 @@ void QF::tickX_(std::uint_fast8_t const tickRate) noexcept
             if (timeEvtHead_[tickRate].m_act != nullptr) {
 
                 // sanity check
-                Q_ASSERT_CRIT_(110, prev != nullptr);
+                Q_ASSERT_IN_CRIT_(110, prev != nullptr,
+                                  QF_TIMEEVT_CRIT_X_(tickRate));
                 prev->m_next = QF::timeEvtHead_[tickRate].toTimeEvt();
                 timeEvtHead_[tickRate].m_act = nullptr;
                 t = prev->m_next; // switch to the new list
@@ -117,7 +136,7 @@ void QF::tickX_(std::uint_fast8_t const tickRate) noexcept
             t->refCtr_ = static_cast<std::uint8_t>(t->refCtr_
                 & static_cast<std::uint8_t>(~TE_IS_LINKED));
             // do NOT advance the prev pointer
-            QF_CRIT_X_(); // exit crit. section to reduce latency
+            QF_TIMEEVT_CRIT_X_(tickRate); // exit crit. sect. to reduce latency
 
             // prevent merging critical sections, see NOTE1 below
             QF_CRIT_EXIT_NOP();
@@ -159,22 +178,103 @@ void QF::tickX_(std::uint_fast8_t const tickRate) noexcept
                     QS_U8_PRE_(tickRate); // tick rate
                 QS_END_NOCRIT_PRE_()
 
-                QF_CRIT_X_(); // exit crit. section before posting
+                QF_TIMEEVT_CRIT_X_(tickRate); // exit before posting
 
                 // asserts if queue overflows
                 static_cast<void>(act->POST(t, sender));
             }
             else {
                 prev = t; // advance to this time event
-                QF_CRIT_X_(); // exit crit. section to reduce latency
+                QF_TIMEEVT_CRIT_X_(tickRate); // reduce latency
 
                 // prevent merging critical sections, see NOTE1 below
                 QF_CRIT_EXIT_NOP();
             }
         }
-        QF_CRIT_E_(); // re-enter crit. section to continue
+        QF_TIMEEVT_CRIT_E_(tickRate); // re-enter crit. section to continue
+    }
+    QF_TIMEEVT_CRIT_X_(tickRate);
+
+#else // timing wheel
+
+    QTimeEvt * const head = &timeEvtHead_[tickRate];
+
+    QF_CRIT_STAT_
+    QF_TIMEEVT_CRIT_E_(tickRate);
+
+    QTimeEvtCtr const now = head->m_ctr + 1U; // the current tick
+    head->m_ctr = now;
+
+    QS_BEGIN_NOCRIT_PRE_(QS_QF_TICK, 0U)
+        QS_TEC_PRE_(now);         // tick ctr
+        QS_U8_PRE_(tickRate);     // tick rate
+    QS_END_NOCRIT_PRE_()
+
+    // move the time events from the current slot to the "pending" list
+    // based on QF::timeEvtHead_[tickRate].next
+    QTimeEvt * volatile * const slot = QF_TIMEEVT_SLOT_(tickRate, now);
+    head->m_next = *slot;
+    if (head->m_next != nullptr) {
+        head->m_next->m_prevNext = &head->m_next;
+    }
+    *slot = nullptr;
+
+    // process the pending time events...
+    for (;;) {
+        QTimeEvt * const t = head->m_next;
+        if (t == nullptr) {
+            break; // all time evts. in the current slot processed
+        }
+        t->wheelUnlink_();
+
+        // time event due in one of the next revolutions of the wheel?
+        if (t->m_ctr != now) {
+            t->wheelLink_(slot); // put it back to the current slot
+            QF_TIMEEVT_CRIT_X_(tickRate); // reduce latency
+
+            // prevent merging critical sections, see NOTE1 below
+            QF_CRIT_EXIT_NOP();
+        }
+        else {
+            QActive * const act = t->toActive(); // temp for volatile
+
+            // periodic time evt?
+            if (t->m_interval != 0U) {
+                t->m_ctr = now + t->m_interval; // rearm the time event
+                t->wheelLink_(QF_TIMEEVT_SLOT_(tickRate, t->m_ctr));
+            }
+            // one-shot time event: automatically disarm
+            else {
+                // mark time event 't' as NOT linked
+                t->refCtr_ = static_cast<std::uint8_t>(t->refCtr_
+                    & static_cast<std::uint8_t>(~TE_IS_LINKED));
+                head->m_interval = head->m_interval - 1U; // one less armed
+
+                QS_BEGIN_NOCRIT_PRE_(QS_QF_TIMEEVT_AUTO_DISARM,
+                                     act->m_prio)
+                    QS_OBJ_PRE_(t);       // this time event object
+                    QS_OBJ_PRE_(act);     // the target AO
+                    QS_U8_PRE_(tickRate); // tick rate
+                QS_END_NOCRIT_PRE_()
+            }
+
+            QS_BEGIN_NOCRIT_PRE_(QS_QF_TIMEEVT_POST, act->m_prio)
+                QS_TIME_PRE_();       // timestamp
+                QS_OBJ_PRE_(t);       // the time event object
+                QS_SIG_PRE_(t->sig);  // signal of this time event
+                QS_OBJ_PRE_(act);     // the target AO
+                QS_U8_PRE_(tickRate); // tick rate
+            QS_END_NOCRIT_PRE_()
+
+            QF_TIMEEVT_CRIT_X_(tickRate); // exit before posting
+
+            // asserts if queue overflows
+            static_cast<void>(act->POST(t, sender));
+        }
+        QF_TIMEEVT_CRIT_E_(tickRate); // re-enter crit. section to continue
     }
-    QF_CRIT_X_();
+    QF_TIMEEVT_CRIT_X_(tickRate);
+#endif // QF_TIMEEVT_WHEEL
 }
 
 //============================================================================
@@ -196,6 +296,10 @@ bool QF::noTimeEvtsActiveX(std::uint_fast8_t const tickRate) noexcept {
     Q_REQUIRE_ID(200, tickRate < QF_MAX_TICK_RATE);
 
     bool inactive;
+#ifdef QF_TIMEEVT_WHEEL
+    // the number of armed time events is kept in the interval of the head
+    inactive = (timeEvtHead_[tickRate].m_interval == 0U);
+#else
     if (timeEvtHead_[tickRate].m_next != nullptr) {
         inactive = false;
     }
@@ -205,9 +309,150 @@ bool QF::noTimeEvtsActiveX(std::uint_fast8_t const tickRate) noexcept {
     else {
         inactive = true;
     }
+#endif // QF_TIMEEVT_WHEEL
     return inactive;
 }
 
+//============================================================================
+//! @description
+//! Find out how many clock ticks remain until the nearest armed time event
+//! expires at the given clock tick rate. This allows a QF port to suspend
+//! the periodic clock tick while the system is idle ("tickless" operation)
+//! and to catch up later with QP::QF::tickNX_().
+//!
+//! @param[in]  tickRate  system clock tick rate to find out about.
+//!
+//! @returns
+//! the number of clock ticks until the next time event expires, or 0 if
+//! no time events are armed at the given tick rate.
+//!
+//! @note
+//! The function is thread-safe.
+//!
+//! @sa QP::QF::tickNX_()
+//!
+QTimeEvtCtr QF::nextExpiryX(std::uint_fast8_t const tickRate) noexcept {
+
+    //! @pre the tick rate must be in range
+    Q_REQUIRE_ID(250, tickRate < QF_MAX_TICK_RATE);
+
+    QF_CRIT_STAT_
+    QF_TIMEEVT_CRIT_E_(tickRate);
+    QTimeEvtCtr const ret = nextExpiry_(tickRate);
+    QF_TIMEEVT_CRIT_X_(tickRate);
+
+    return ret;
+}
+
+//============================================================================
+//! @note
+//! This function should be called in critical section.
+//!
+QTimeEvtCtr QF::nextExpiry_(std::uint_fast8_t const tickRate) noexcept {
+    QTimeEvtCtr next = 0U; // no time events armed (yet)
+
+#ifndef QF_TIMEEVT_WHEEL
+    // scan the main list and the list of "freshly armed" time events
+    QTimeEvt *t = timeEvtHead_[tickRate].m_next;
+    for (std::uint_fast8_t n = 0U; n < 2U; ++n) {
+        for (; t != nullptr; t = t->m_next) {
+            QTimeEvtCtr const ctr = t->m_ctr; // temporary to hold volatile
+            if ((ctr != 0U) && ((next == 0U) || (ctr < next))) {
+                next = ctr;
+            }
+        }
+        t = timeEvtHead_[tickRate].toTimeEvt();
+    }
+#else // timing wheel
+    // scan the slots following the current tick, until no later slot
+    // can hold a time event expiring sooner than the one already found
+    QTimeEvtCtr const now = timeEvtHead_[tickRate].m_ctr;
+    for (std::uint32_t j = 1U;
+         (j <= QF_TIMEEVT_WHEEL) && ((next == 0U) || (next > j));
+         ++j)
+    {
+        for (QTimeEvt *t = *QF_TIMEEVT_SLOT_(tickRate, now + j);
+             t != nullptr;
+             t = t->m_next)
+        {
+            QTimeEvtCtr const ctr = static_cast<QTimeEvtCtr>(t->m_ctr - now);
+            if ((next == 0U) || (ctr < next)) {
+                next = ctr;
+            }
+        }
+    }
+#endif // QF_TIMEEVT_WHEEL
+
+    return next;
+}
+
+#ifdef Q_SPY
+//============================================================================
+//! @description
+//! This function has the same effect as @p nTicks invocations of
+//! QP::QF::tickX_(), but it performs the full tick processing only for the
+//! ticks in which some time events expire. The other ticks are skipped by
+//! adjusting the time events at once. This function is intended for the
+//! "tickless" operation, in which the QF port suspends the periodic clock
+//! tick until the next expiration reported by QP::QF::nextExpiryX().
+//!
+//! @param[in] tickRate  system clock tick rate serviced in this call [1..15].
+//! @param[in] nTicks    number of clock ticks elapsed at this tick rate.
+//! @param[in] sender    pointer to a sender object (used in QS only).
+//!
+//! @note
+//! this function should be called only via the macro TICKN_X()
+//!
+//! @note
+//! the skipped ticks do not produce the QS_QF_TICK trace records, but
+//! the tick counter reported in the next QS_QF_TICK record accounts for
+//! them.
+//!
+void QF::tickNX_(std::uint_fast8_t const tickRate,
+                 QTimeEvtCtr const nTicks,
+                 void const * const sender) noexcept
+#else
+void QF::tickNX_(std::uint_fast8_t const tickRate,
+                 QTimeEvtCtr const nTicks) noexcept
+#endif
+{
+    QTimeEvtCtr n = nTicks; // ticks remaining to process
+    while (n != 0U) {
+        QF_CRIT_STAT_
+        QF_TIMEEVT_CRIT_E_(tickRate);
+
+        // skip the ticks in which no time events expire...
+        QTimeEvtCtr const next = nextExpiry_(tickRate);
+        QTimeEvtCtr const skip = ((next == 0U) || (next > n))
+                                 ? n
+                                 : static_cast<QTimeEvtCtr>(next - 1U);
+        if (skip != 0U) {
+            timeEvtHead_[tickRate].m_ctr =
+                static_cast<QTimeEvtCtr>(timeEvtHead_[tickRate].m_ctr + skip);
+#ifndef QF_TIMEEVT_WHEEL
+            // none of the armed time events expires within 'skip' ticks
+            QTimeEvt *t = timeEvtHead_[tickRate].m_next;
+            for (std::uint_fast8_t k = 0U; k < 2U; ++k) {
+                for (; t != nullptr; t = t->m_next) {
+                    if (t->m_ctr != 0U) {
+                        t->m_ctr = static_cast<QTimeEvtCtr>(t->m_ctr - skip);
+                    }
+                }
+                t = timeEvtHead_[tickRate].toTimeEvt();
+            }
+#endif // QF_TIMEEVT_WHEEL (the wheel needs no adjustments)
+            n = static_cast<QTimeEvtCtr>(n - skip);
+        }
+        QF_TIMEEVT_CRIT_X_(tickRate);
+
+        // process the tick in which some time events expire
+        if (n != 0U) {
+            TICK_X(tickRate, sender);
+            n = static_cast<QTimeEvtCtr>(n - 1U);
+        }
+    }
+}
+
 //============================================================================
 //! @description
 //! When creating a time event, you must commit it to a specific active object
@@ -231,6 +476,9 @@ QTimeEvt::QTimeEvt(QActive * const act,
     m_act(act),
     m_ctr(0U),
     m_interval(0U)
+#ifdef QF_TIMEEVT_WHEEL
+    , m_prevNext(nullptr)
+#endif
 {
     //! @pre The signal must be valid and the tick rate in range
     Q_REQUIRE_ID(300, (sgnl >= Q_USER_SIG)
@@ -267,6 +515,9 @@ QTimeEvt::QTimeEvt() noexcept
     m_act(nullptr),
     m_ctr(0U),
     m_interval(0U)
+#ifdef QF_TIMEEVT_WHEEL
+    , m_prevNext(nullptr)
+#endif
 {
 #ifndef Q_EVT_CTOR
     sig = 0U;
@@ -317,7 +568,12 @@ void QTimeEvt::armX(QTimeEvtCtr const nTicks,
                     QTimeEvtCtr const interval) noexcept
 {
     std::uint8_t const tickRate = refCtr_ & TE_TICK_RATE;
+#ifndef QF_TIMEEVT_WHEEL
     QTimeEvtCtr const ctr = m_ctr;  // temporary to hold volatile
+#else
+    // in the timing wheel a time event is linked exactly while it is armed
+    QTimeEvtCtr const ctr = ((refCtr_ & TE_IS_LINKED) != 0U) ? 1U : 0U;
+#endif
 
     //! @pre the host AO must be valid, time evnet must be disarmed,
     //! number of clock ticks cannot be zero, and the signal must be valid.
@@ -332,7 +588,8 @@ void QTimeEvt::armX(QTimeEvtCtr const nTicks,
 #endif
 
     QF_CRIT_STAT_
-    QF_CRIT_E_();
+    QF_TIMEEVT_CRIT_E_(tickRate);
+#ifndef QF_TIMEEVT_WHEEL
     m_ctr = nTicks;
     m_interval = interval;
 
@@ -358,6 +615,16 @@ void QTimeEvt::armX(QTimeEvtCtr const nTicks,
         m_next = QF::timeEvtHead_[tickRate].toTimeEvt();
         QF::timeEvtHead_[tickRate].m_act = this;
     }
+#else // timing wheel
+    QTimeEvt * const head = &QF::timeEvtHead_[tickRate];
+    m_ctr = head->m_ctr + nTicks; // the absolute expiration tick
+    m_interval = interval;
+
+    // mark as linked and insert into the wheel slot of the expiration tick
+    refCtr_ = static_cast<std::uint8_t>(refCtr_ | TE_IS_LINKED);
+    wheelLink_(QF_TIMEEVT_SLOT_(tickRate, m_ctr));
+    head->m_interval = head->m_interval + 1U; // one more armed
+#endif // QF_TIMEEVT_WHEEL
 
 #ifdef Q_SPY
     std::uint_fast8_t const qs_id = static_cast<QActive *>(m_act)->m_prio;
@@ -371,7 +638,9 @@ void QTimeEvt::armX(QTimeEvtCtr const nTicks,
         QS_U8_PRE_(tickRate);  // tick rate
     QS_END_NOCRIT_PRE_()
 
-    QF_CRIT_X_();
+    QF_TIMEEVT_CRIT_X_(tickRate);
+
+    QF_TIMEEVT_ARMED_(tickRate); // notify the (tickless) QF port
 }
 
 //============================================================================
@@ -392,13 +661,14 @@ void QTimeEvt::armX(QTimeEvtCtr const nTicks,
 //!
 bool QTimeEvt::disarm(void) noexcept {
     QF_CRIT_STAT_
-    QF_CRIT_E_();
+    QF_TIMEEVT_CRIT_E_(refCtr_ & TE_TICK_RATE);
 #ifdef Q_SPY
     std::uint_fast8_t const qs_id = static_cast<QActive *>(m_act)->m_prio;
 #endif
 
     // is the time event actually armed?
     bool wasArmed;
+#ifndef QF_TIMEEVT_WHEEL
     if (m_ctr != 0U) {
         wasArmed = true;
         refCtr_ = static_cast<std::uint8_t>(refCtr_ | TE_WAS_DISARMED);
@@ -414,6 +684,28 @@ bool QTimeEvt::disarm(void) noexcept {
 
         m_ctr = 0U; // schedule removal from the list
     }
+#else // timing wheel
+    if ((refCtr_ & TE_IS_LINKED) != 0U) {
+        QTimeEvt * const head = &QF::timeEvtHead_[refCtr_ & TE_TICK_RATE];
+        wasArmed = true;
+
+        QS_BEGIN_NOCRIT_PRE_(QS_QF_TIMEEVT_DISARM, qs_id)
+            QS_TIME_PRE_();            // timestamp
+            QS_OBJ_PRE_(this);         // this time event object
+            QS_OBJ_PRE_(m_act);        // the target AO
+            QS_TEC_PRE_(m_ctr - head->m_ctr); // the number of ticks
+            QS_TEC_PRE_(m_interval);   // the interval
+            QS_U8_PRE_(refCtr_& TE_TICK_RATE);
+        QS_END_NOCRIT_PRE_()
+
+        // remove from the wheel right away and mark as NOT linked
+        wheelUnlink_();
+        refCtr_ = static_cast<std::uint8_t>((refCtr_ | TE_WAS_DISARMED)
+            & static_cast<std::uint8_t>(~TE_IS_LINKED));
+        head->m_interval = head->m_interval - 1U; // one less armed
+        m_ctr = 0U;
+    }
+#endif // QF_TIMEEVT_WHEEL
     else { // the time event was already disarmed automatically
         wasArmed = false;
         refCtr_ = static_cast<std::uint8_t>(refCtr_
@@ -427,7 +719,7 @@ bool QTimeEvt::disarm(void) noexcept {
         QS_END_NOCRIT_PRE_()
 
     }
-    QF_CRIT_X_();
+    QF_TIMEEVT_CRIT_X_(refCtr_ & TE_TICK_RATE);
 
     return wasArmed;
 }
@@ -464,10 +756,11 @@ bool QTimeEvt::rearm(QTimeEvtCtr const nTicks) noexcept {
         && (static_cast<enum_t>(sig) >= Q_USER_SIG));
 
     QF_CRIT_STAT_
-    QF_CRIT_E_();
+    QF_TIMEEVT_CRIT_E_(tickRate);
 
     // is the time evt not running?
     bool wasArmed;
+#ifndef QF_TIMEEVT_WHEEL
     if (m_ctr == 0U) {
         wasArmed = false;
 
@@ -497,6 +790,22 @@ bool QTimeEvt::rearm(QTimeEvtCtr const nTicks) noexcept {
         wasArmed = true;
     }
     m_ctr = nTicks; // re-load the tick counter (shift the phasing)
+#else // timing wheel
+    QTimeEvt * const head = &QF::timeEvtHead_[tickRate];
+    if ((refCtr_ & TE_IS_LINKED) == 0U) {
+        wasArmed = false;
+        // mark as linked
+        refCtr_ = static_cast<std::uint8_t>(refCtr_ | TE_IS_LINKED);
+        head->m_interval = head->m_interval + 1U; // one more armed
+    }
+    else {
+        wasArmed = true;
+        wheelUnlink_(); // remove from the old wheel slot
+    }
+    // re-load the expiration tick (shift the phasing)
+    m_ctr = head->m_ctr + nTicks;
+    wheelLink_(QF_TIMEEVT_SLOT_(tickRate, m_ctr));
+#endif // QF_TIMEEVT_WHEEL
 
 #ifdef Q_SPY
     std::uint_fast8_t const qs_id = static_cast<QActive *>(m_act)->m_prio;
@@ -505,12 +814,14 @@ bool QTimeEvt::rearm(QTimeEvtCtr const nTicks) noexcept {
         QS_TIME_PRE_();          // timestamp
         QS_OBJ_PRE_(this);       // this time event object
         QS_OBJ_PRE_(m_act);      // the target AO
-        QS_TEC_PRE_(m_ctr);      // the number of ticks
+        QS_TEC_PRE_(nTicks);     // the number of ticks
         QS_TEC_PRE_(m_interval); // the interval
         QS_2U8_PRE_(tickRate, (wasArmed ? 1U : 0U));
     QS_END_NOCRIT_PRE_()
 
-    QF_CRIT_X_();
+    QF_TIMEEVT_CRIT_X_(tickRate);
+
+    QF_TIMEEVT_ARMED_(tickRate); // notify the (tickless) QF port
 
     return wasArmed;
 }
@@ -557,9 +868,16 @@ bool QTimeEvt::wasDisarmed(void) noexcept {
 //!
 QTimeEvtCtr QTimeEvt::currCtr(void) const noexcept {
     QF_CRIT_STAT_
-    QF_CRIT_E_();
+    QF_TIMEEVT_CRIT_E_(refCtr_ & TE_TICK_RATE);
+#ifndef QF_TIMEEVT_WHEEL
     QTimeEvtCtr const ret = m_ctr;
-    QF_CRIT_X_();
+#else
+    QTimeEvtCtr const ret = ((refCtr_ & TE_IS_LINKED) != 0U)
+        ? static_cast<QTimeEvtCtr>(m_ctr
+              - QF::timeEvtHead_[refCtr_ & TE_TICK_RATE].m_ctr)
+        : 0U;
+#endif
+    QF_TIMEEVT_CRIT_X_(refCtr_ & TE_TICK_RATE);
 
     return ret;
 }
@@ -576,3 +894,18 @@ QTimeEvtCtr QTimeEvt::currCtr(void) const noexcept {
 // The QF_CRIT_EXIT_NOP() macro contains minimal code required
 // to prevent such merging of critical sections in QF ports,
 // in which it can occur.
+//
+//============================================================================
+// NOTE2:
+// With the QF_TIMEEVT_WHEEL configuration, the armed time events of every
+// tick rate are kept in a hashed timing wheel of QF_TIMEEVT_WHEEL slots.
+// The head time event QF::timeEvtHead_[tickRate] counts the ticks in m_ctr
+// and the armed time events in m_interval. An armed time event holds its
+// absolute expiration tick in m_ctr and resides in the slot
+// (m_ctr % QF_TIMEEVT_WHEEL). Every QF::tickX_() visits only the slot of
+// the current tick, so the cost of a tick is proportional to the number of
+// expiring time events plus the time events due in later revolutions of the
+// wheel (about armed/QF_TIMEEVT_WHEEL on average), rather than to the number
+// of all armed time events. Time events are doubly linked (m_prevNext), so
+// disarm() and rearm() unlink them immediately, without the deferred
+// unlinking of the list implementation.
@@ -80,34 +80,195 @@
     #define Q_ASSERT_CRIT_(id_, test_)  static_cast<void>(0)
     #define Q_REQUIRE_CRIT_(id_, test_) static_cast<void>(0)
     #define Q_ERROR_CRIT_(id_)          static_cast<void>(0)
+    #define Q_ASSERT_IN_CRIT_(id_, test_, crit_x_)  static_cast<void>(0)
+    #define Q_REQUIRE_IN_CRIT_(id_, test_, crit_x_) static_cast<void>(0)
+    #define Q_ERROR_IN_CRIT_(id_, crit_x_)          static_cast<void>(0)
 
 #else  // Q_NASSERT not defined--assertion checking enabled
 
-    #define Q_ASSERT_CRIT_(id_, test_) do {\
+    //! assertion inside the critical section exited with @p crit_x_
+    //! (such as QF_MPOOL_CRIT_X_(this)) before calling Q_onAssert()
+    #define Q_ASSERT_IN_CRIT_(id_, test_, crit_x_) do {\
         if ((test_)) {} else { \
-            QF_CRIT_X_(); \
+            crit_x_; \
             Q_onAssert(&Q_this_module_[0], static_cast<int_t>(id_)); \
         } \
     } while (false)
 
-    #define Q_REQUIRE_CRIT_(id_, test_) Q_ASSERT_CRIT_((id_), (test_))
+    #define Q_REQUIRE_IN_CRIT_(id_, test_, crit_x_) \
+        Q_ASSERT_IN_CRIT_((id_), (test_), crit_x_)
 
-    #define Q_ERROR_CRIT_(id_) do { \
-        QF_CRIT_X_(); \
+    #define Q_ERROR_IN_CRIT_(id_, crit_x_) do { \
+        crit_x_; \
         Q_onAssert(&Q_this_module_[0], static_cast<int_t>(id_)); \
     } while (false)
 
+    #define Q_ASSERT_CRIT_(id_, test_) \
+        Q_ASSERT_IN_CRIT_((id_), (test_), QF_CRIT_X_())
+
+    #define Q_REQUIRE_CRIT_(id_, test_) Q_ASSERT_CRIT_((id_), (test_))
+
+    #define Q_ERROR_CRIT_(id_)  Q_ERROR_IN_CRIT_((id_), QF_CRIT_X_())
+
 #endif // Q_NASSERT
 
+// Critical sections of the individual QF data structures --------------------
+// By default, all QF data structures are protected by the same critical
+// section (QF_CRIT_E_()/QF_CRIT_X_()). A QF port for a multi-core host can
+// define the following macros to protect the event queues of active objects,
+// event pools, subscriber lists, time-event lists and event reference
+// counters independently, so that unrelated operations do not serialize.
+// The critical-section status variable (QF_CRIT_STAT_) must be declared
+// in every scope using these macros.
+//
+#ifndef QACTIVE_EQUEUE_CRIT_E_
+    //! enter the critical section protecting the event queue of AO @p me_
+    #define QACTIVE_EQUEUE_CRIT_E_(me_)  QF_CRIT_E_()
+
+    //! exit the critical section protecting the event queue of AO @p me_
+    #define QACTIVE_EQUEUE_CRIT_X_(me_)  QF_CRIT_X_()
+
+    //! the event queues are protected by the single QF critical section
+    #define QACTIVE_EQUEUE_CRIT_GLOBAL_  1
+#endif
+
+#ifndef QF_MPOOL_CRIT_E_
+    //! enter the critical section protecting the memory pool @p me_
+    #define QF_MPOOL_CRIT_E_(me_)        QF_CRIT_E_()
+
+    //! exit the critical section protecting the memory pool @p me_
+    #define QF_MPOOL_CRIT_X_(me_)        QF_CRIT_X_()
+#endif
+
+#ifndef QF_PS_CRIT_E_
+    //! enter the critical section protecting the subscriber lists
+    #define QF_PS_CRIT_E_()              QF_CRIT_E_()
+
+    //! exit the critical section protecting the subscriber lists
+    #define QF_PS_CRIT_X_()              QF_CRIT_X_()
+
+    //! the subscriber lists are protected by the single QF critical section
+    #define QF_PS_CRIT_GLOBAL_           1
+#endif
+
+#ifndef QF_TIMEEVT_CRIT_E_
+    //! enter the critical section protecting time events of @p tickRate_
+    #define QF_TIMEEVT_CRIT_E_(tickRate_) QF_CRIT_E_()
+
+    //! exit the critical section protecting time events of @p tickRate_
+    #define QF_TIMEEVT_CRIT_X_(tickRate_) QF_CRIT_X_()
+#endif
+
+// The macro QF_EVT_REF_ATOMIC (defined in qf_port.hpp or on the command
+// line) makes the reference counters of dynamic events atomic (GCC-style
+// __atomic builtins). Posting, publishing and garbage-collecting a shared
+// event then no longer enter any critical section just to update the
+// reference counter. QP::QF::gc() recycles the event when it atomically
+// releases the last reference.
+#ifdef QF_EVT_REF_ATOMIC
+    #ifdef QF_EVT_CRIT_E_
+        #error "QF_EVT_REF_ATOMIC replaces the port's QF_EVT_CRIT_E_()"
+    #endif
+
+    #ifdef Q_SPY
+        //! the QS records of the reference counters still need the QF
+        //! critical section, which no longer protects the counters
+        #define QF_EVT_CRIT_E_(e_)       QF_CRIT_E_()
+        #define QF_EVT_CRIT_X_(e_)       QF_CRIT_X_()
+    #else
+        //! no critical section around the atomic reference counters
+        #define QF_EVT_CRIT_E_(e_)       static_cast<void>(0)
+        #define QF_EVT_CRIT_X_(e_)       static_cast<void>(0)
+    #endif
+    #define QF_EVT_REF_LOCK_(e_)         static_cast<void>(0)
+    #define QF_EVT_REF_UNLOCK_(e_)       static_cast<void>(0)
+
+#elif (!defined QF_EVT_CRIT_E_)
+    //! enter the critical section protecting the reference counter of
+    //! the dynamic event @p e_ (outside of any other critical section)
+    #define QF_EVT_CRIT_E_(e_)           QF_CRIT_E_()
+
+    //! exit the critical section entered with QF_EVT_CRIT_E_()
+    #define QF_EVT_CRIT_X_(e_)           QF_CRIT_X_()
+
+    //! lock the reference counter of the dynamic event @p e_ from inside
+    //! another critical section (no-op with the single critical section)
+    #define QF_EVT_REF_LOCK_(e_)         static_cast<void>(0)
+
+    //! unlock the reference counter locked with QF_EVT_REF_LOCK_()
+    #define QF_EVT_REF_UNLOCK_(e_)       static_cast<void>(0)
+
+    //! the event reference counters are protected by the single QF
+    //! critical section
+    #define QF_EVT_CRIT_GLOBAL_          1
+#endif
+
+#ifdef QF_PS_FILTER
+    //! does the subscriber @p a_ accept the published event @p e_?
+    //! (see QP::QActive::setPublishFilter())
+    #define QF_PS_ACCEPTS_(a_, e_)       ((a_)->psAccepts_(e_))
+#else
+    //! every subscriber accepts all published events (no filters)
+    #define QF_PS_ACCEPTS_(a_, e_)       true
+#endif
+
+#ifndef QF_EPOOL_GETN_
+    //! allocate up to @p n_ blocks from the event pool @p p_ at once
+    //! (the default for the native QF memory pool QP::QMPool)
+    #define QF_EPOOL_GETN_(p_, blocks_, n_, m_, qs_id_) \
+        ((p_).getN((blocks_), (n_), (m_), (qs_id_)))
+
+    //! recycle @p n_ blocks to the event pool @p p_ at once
+    #define QF_EPOOL_PUTN_(p_, blocks_, n_, qs_id_) \
+        ((p_).putN((blocks_), (n_), (qs_id_)))
+#endif
+
+#ifndef QACTIVE_EQUEUE_FREED_
+    //! notify the QF port that an entry in the event queue of the AO @p me_
+    //! has been freed (e.g., to wake up producers blocked on a full queue).
+    //! Invoked outside of any critical section.
+    #define QACTIVE_EQUEUE_FREED_(me_)   static_cast<void>(0)
+#endif
+
+#ifndef QF_TIMEEVT_ARMED_
+    //! notify the QF port that a time event at @p tickRate_ has been armed
+    //! or rearmed (e.g., to shorten the sleep of a "tickless" port).
+    //! Invoked outside of any critical section.
+    #define QF_TIMEEVT_ARMED_(tickRate_) static_cast<void>(0)
+#endif
+
+#if (defined QF_EQUEUE_LOCKFREE) && (!defined QF_EQUEUE_LF_RELAX_)
+    //! back off while the consumer of the lock-free event queue waits
+    //! for a producer to complete storing the event in a claimed entry
+    #define QF_EQUEUE_LF_RELAX_()        static_cast<void>(0)
+#endif
+
 
 namespace QP {
 
 // package-scope objects -----------------------------------------------------
 extern QF_EPOOL_TYPE_ QF_pool_[QF_MAX_EPOOL]; //!< allocate event pools
 extern std::uint_fast8_t QF_maxPool_; //!< # of initialized event pools
+extern std::uint8_t QF_poolLut_[QF_EPOOL_LUT_SIZE]; //!< size->pool lookup
+#ifdef QF_MAX_BUFPOOL
+extern QF_EPOOL_TYPE_ QF_bufPool_[QF_MAX_BUFPOOL]; //!< payload-buffer pools
+extern std::uint_fast8_t QF_maxBufPool_; //!< # initialized buffer pools
+extern QF_EPOOL_TYPE_ QF_bufEvtPool_; //!< the pool of buffer events
+#endif
 extern QSubscrList *QF_subscrList_;   //!< the subscriber list array
 extern enum_t QF_maxPubSignal_;       //!< the maximum published signal
 
+#ifndef QF_PS_SPARSE
+    //! the subscriber list of the signal @p sig_ (in a critical section)
+    #define QF_PS_LIST_(sig_)   (QF_subscrList_[(sig_)])
+#else
+    //! the subscriber list of the signal @p sig_ (in a critical section)
+    #define QF_PS_LIST_(sig_)   (QF_psList_(static_cast<enum_t>(sig_)))
+
+//! subscriber list of a signal in the compact subscriber table
+QSubscrList const &QF_psList_(enum_t const sig) noexcept;
+#endif
+
 //............................................................................
 //! Structure representing a free block in the Native QF Memory Pool
 //! @sa QP::QMPool
@@ -125,9 +286,42 @@ constexpr std::uint8_t TE_IS_LINKED    = 1U << 7U;  // flag
 constexpr std::uint8_t TE_WAS_DISARMED = 1U << 6U;  // flag
 constexpr std::uint8_t TE_TICK_RATE    = 0x0FU;     // bitmask
 
+#ifdef QF_MAX_BUFPOOL
+//! the pool ID of the buffer events (QP::QBufEvt), which are allocated
+//! from the dedicated pool QP::QF_bufEvtPool_ rather than from QF_pool_[]
+constexpr std::uint8_t QF_BUF_EVT_POOL_ID =
+    static_cast<std::uint8_t>(QF_MAX_EPOOL + 1U);
+#endif
+
+//! the granularity of the event sizes in the QP::QF_poolLut_ lookup table
+constexpr std::uint_fast16_t QF_EPOOL_LUT_GRAN = sizeof(void *);
+
 //============================================================================
 // internal helper inline functions
 
+//! find the index of the first event pool that fits events of @p evtSize
+//! @description
+//! The lookup table QP::QF_poolLut_ provides the index of the first pool
+//! that can fit the smallest event in the size class of @p evtSize, so
+//! the search is typically finished without iterating over the pools.
+//! Event sizes beyond the table start from its last entry.
+//!
+//! @returns the pool index, or QP::QF_maxPool_ if no pool fits @p evtSize
+inline std::uint_fast8_t QF_poolFind_(std::uint_fast16_t const evtSize)
+    noexcept
+{
+    std::uint_fast16_t const cls = evtSize / QF_EPOOL_LUT_GRAN;
+    std::uint_fast8_t idx = (cls < QF_EPOOL_LUT_SIZE)
+        ? static_cast<std::uint_fast8_t>(QF_poolLut_[cls])
+        : static_cast<std::uint_fast8_t>(QF_poolLut_[QF_EPOOL_LUT_SIZE - 1U]);
+    while ((idx < QF_maxPool_)
+           && (evtSize > QF_EPOOL_EVENT_SIZE_(QF_pool_[idx])))
+    {
+        ++idx;
+    }
+    return idx;
+}
+
 //! return the Pool-ID of an event @p e
 inline std::uint8_t QF_EVT_POOL_ID_ (QEvt const * const e) noexcept {
     return e->poolId_;
@@ -138,6 +332,8 @@ inline std::uint8_t QF_EVT_REF_CTR_ (QEvt const * const e) noexcept {
     return e->refCtr_;
 }
 
+#ifndef QF_EVT_REF_ATOMIC
+
 //! increment the refCtr_ of an event @p e
 inline void QF_EVT_REF_CTR_INC_(QEvt const * const e) noexcept {
     (QF_EVT_CONST_CAST_(e))->refCtr_ = (QF_EVT_CONST_CAST_(e))->refCtr_ + 1U;
@@ -148,6 +344,44 @@ inline void QF_EVT_REF_CTR_DEC_(QEvt const * const e) noexcept {
     (QF_EVT_CONST_CAST_(e))->refCtr_ = (QF_EVT_CONST_CAST_(e))->refCtr_ - 1U;
 }
 
+#else // atomic event reference counters
+
+//! atomically drop one reference counted by @p ctr
+//! @returns the value of the counter before the release, where 0 or 1
+//! means that the released reference was the last one
+inline std::uint8_t QF_refCtrRelease_(std::uint8_t volatile * const ctr)
+    noexcept
+{
+    // a zero counter cannot change concurrently, because then the only
+    // reference is held by the caller
+    std::uint8_t const refCtr = __atomic_load_n(ctr, __ATOMIC_ACQUIRE);
+    return (refCtr == 0U)
+           ? refCtr
+           : __atomic_fetch_sub(ctr, 1U, __ATOMIC_ACQ_REL);
+}
+
+//! atomically increment the refCtr_ of an event @p e
+inline void QF_EVT_REF_CTR_INC_(QEvt const * const e) noexcept {
+    // a new reference is always made from an existing one
+    __atomic_fetch_add(&QF_EVT_CONST_CAST_(e)->refCtr_, 1U,
+                       __ATOMIC_RELAXED);
+}
+
+//! atomically decrement the refCtr_ of an event @p e, which is known
+//! not to be the last reference
+inline void QF_EVT_REF_CTR_DEC_(QEvt const * const e) noexcept {
+    __atomic_fetch_sub(&QF_EVT_CONST_CAST_(e)->refCtr_, 1U,
+                       __ATOMIC_RELEASE);
+}
+
+//! atomically drop one reference to the event @p e
+//! @returns the refCtr_ before the release (see QP::QF_refCtrRelease_())
+inline std::uint8_t QF_EVT_REF_CTR_RELEASE_(QEvt const * const e) noexcept {
+    return QF_refCtrRelease_(&QF_EVT_CONST_CAST_(e)->refCtr_);
+}
+
+#endif // QF_EVT_REF_ATOMIC
+
 } // namespace QP
 
 //! macro to test that a pointer @p x_ is in range between @p min_ and @p max_
@@ -395,10 +395,25 @@ void QK_activate_(void) noexcept {
         // 2. dispatch the event to the AO's state machine.
         // 3. determine if event is garbage and collect it if so
         //
-        QP::QEvt const * const e = a->get_();
+        QP::QEvt const *e = a->get_();
         a->dispatch(e, a->m_prio);
         QP::QF::gc(e);
 
+#ifdef QF_ACTIVE_BATCH
+        // dispatch more events to the same AO within its batch budget,
+        // without re-evaluating the priorities. The emptiness check
+        // needs no critical section, because only the AO itself can
+        // empty its queue.
+        for (std::uint_fast8_t n = a->m_batch;
+             (n > 1U) && (!a->m_eQueue.isEmpty());
+             --n)
+        {
+            e = a->get_();
+            a->dispatch(e, a->m_prio);
+            QP::QF::gc(e);
+        }
+#endif
+
         // determine the next highest-priority AO ready to run...
         QF_INT_DISABLE();
 
@@ -171,11 +171,14 @@ void QS::glbFilter_(std::int_fast16_t const filter) noexcept {
                     static_cast<std::uint8_t>(~0x07U & 0xFFU);
                 priv_.glbFilter[5] &=
                     static_cast<std::uint8_t>(~0x20U & 0xFFU);
+                priv_.glbFilter[9] &=
+                    static_cast<std::uint8_t>(~0x01U & 0xFFU);
             }
             else {
                 priv_.glbFilter[1] |= 0xFCU;
                 priv_.glbFilter[2] |= 0x07U;
                 priv_.glbFilter[5] |= 0x20U;
+                priv_.glbFilter[9] |= 0x01U;
             }
             break;
         case QS_EQ_RECORDS:
@@ -212,12 +215,15 @@ void QS::glbFilter_(std::int_fast16_t const filter) noexcept {
                     static_cast<std::uint8_t>(~0xC0U & 0xFFU);
                 priv_.glbFilter[5] &=
                     static_cast<std::uint8_t>(~0x1FU & 0xFFU);
+                priv_.glbFilter[8] &=
+                    static_cast<std::uint8_t>(~0x80U & 0xFFU);
             }
             else {
                 priv_.glbFilter[2] |= 0x80U;
                 priv_.glbFilter[3] |= 0xFCU;
                 priv_.glbFilter[4] |= 0xC0U;
                 priv_.glbFilter[5] |= 0x1FU;
+                priv_.glbFilter[8] |= 0x80U;
             }
             break;
         case QS_TE_RECORDS:
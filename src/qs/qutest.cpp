@@ -244,9 +244,7 @@ bool QActiveDummy::post_(QEvt const * const e,
     // as producing the #QS_QF_ACTIVE_POST trace record, which are:
     // the local filter for this AO ('me->prio') is set
     //
-    if ((QS::priv_.locFilter[m_prio >> 3U]
-         & (1U << (m_prio & 7U))) != 0U)
-    {
+    if (QS_LOC_CHECK_(m_prio)) {
         QS::onTestPost(sender, this, e, status);
     }
 
@@ -288,9 +286,7 @@ void QActiveDummy::postLIFO(QEvt const * const e) noexcept {
     // as producing the #QS_QF_ACTIVE_POST trace record, which are:
     // the local filter for this AO ('me->prio') is set
     //
-    if ((QS::priv_.locFilter[m_prio >> 3U]
-         & (1U << (m_prio & 7U))) != 0U)
-    {
+    if (QS_LOC_CHECK_(m_prio)) {
         QS::onTestPost(nullptr, this, e, true);
     }
 
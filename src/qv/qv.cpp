@@ -162,10 +162,25 @@ int_t QF::run(void) {
             // 2. dispatch the event to the AO's state machine.
             // 3. determine if event is garbage and collect it if so
             //
-            QEvt const * const e = a->get_();
+            QEvt const *e = a->get_();
             a->dispatch(e, a->m_prio);
             gc(e);
 
+#ifdef QF_ACTIVE_BATCH
+            // dispatch more events to the same AO within its batch budget,
+            // without re-evaluating the priorities. The emptiness check
+            // needs no critical section, because only the AO itself can
+            // empty its queue.
+            for (std::uint_fast8_t n = a->m_batch;
+                 (n > 1U) && (!a->m_eQueue.isEmpty());
+                 --n)
+            {
+                e = a->get_();
+                a->dispatch(e, a->m_prio);
+                gc(e);
+            }
+#endif
+
             QF_INT_DISABLE();
 
             if (a->m_eQueue.isEmpty()) { // empty queue?
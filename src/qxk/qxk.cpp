@@ -45,6 +45,11 @@
     #error "Source file included in a project NOT based on the QXK kernel"
 #endif // QXK_HPP
 
+// the QXK lock priority (QF_MAX_ACTIVE + 1) must fit in QXK_Attr::lockPrio
+#if (QF_MAX_ACTIVE > 254U)
+    #error "QXK requires QF_MAX_ACTIVE not exceeding 254U"
+#endif
+
 
 // Public-scope objects ******************************************************
 extern "C" {